@@ -0,0 +1,46 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+
+#ifndef DELAY_H_
+#define DELAY_H_
+
+#include "chip.h"
+
+/**
+ * Waits of at least this many microseconds sleep until a match interrupt of the 16-bit timer; shorter waits use a
+ * busy loop. Sleep has no exit latency, so the break-even point is the cost of arming the timer.
+ */
+#ifndef DELAY_SLEEP_THRESHOLD
+    #define DELAY_SLEEP_THRESHOLD 100
+#endif
+
+/**
+ * Initializes the delay service: the 16-bit timer CT16B0 counts microseconds from now on, and the busy loop is
+ * calibrated against it. #Delay_Us is installed as the wait of the drivers (see #Chip_Clock_System_SetWait), and
+ * keeps working across changes of the performance level.
+ * @pre #Perf_Init has been called, with a System Clock frequency of at least 1 MHz.
+ */
+void Delay_Init(void);
+
+/**
+ * Waits at least the given time.
+ * - Short waits busy loop, with a loop count derived from @c us by a multiplication and a shift.
+ * - Waits of #DELAY_SLEEP_THRESHOLD and more sleep until a match interrupt of the 16-bit timer. Interrupts are
+ *  handled while sleeping, unless they are disabled by the caller: the wait then ends on the timer itself.
+ * .
+ * @param us : The time to wait in microseconds.
+ * @note Before #Delay_Init, this is #Chip_Clock_System_BusyWait_us.
+ */
+void Delay_Us(uint32_t us);
+
+#endif
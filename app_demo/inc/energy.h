@@ -0,0 +1,163 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+
+#ifndef ENERGY_H_
+#define ENERGY_H_
+
+#include "chip.h"
+
+/**
+ * The offset, in bytes, in EEPROM where the counters are stored by #Energy_Save. The record occupies 104 bytes.
+ * By default, the fifth and fourth last writable EEPROM rows are used.
+ */
+#ifndef ENERGY_EEPROM_OFFSET
+    #define ENERGY_EEPROM_OFFSET ((EEPROM_NR_OF_RW_ROWS - 5) * EEPROM_ROW_SIZE)
+#endif
+
+/** The MIME type used for the NDEF record that is created by #Energy_CreateRecord. */
+#ifndef ENERGY_MIME_TYPE
+    #define ENERGY_MIME_TYPE "application/vnd.nxp.energy"
+#endif
+
+/**
+ * @name Operation currents
+ * The supply current drawn by each long operation on top of #POWER_ACTIVE_CURRENT, in nA. Like the energy model in
+ * power.h, these are typical figures, to be overridden in app_sel.h after measuring the board.
+ * @{
+ */
+
+/** Erasing and programming an EEPROM row. */
+#ifndef ENERGY_EEPROM_CURRENT
+    #define ENERGY_EEPROM_CURRENT 600000
+#endif
+
+/** A temperature sensor conversion. */
+#ifndef ENERGY_TSEN_CURRENT
+    #define ENERGY_TSEN_CURRENT 50000
+#endif
+
+/** An NFC field: the NFC block is powered by the field itself. */
+#ifndef ENERGY_NFC_CURRENT
+    #define ENERGY_NFC_CURRENT 0
+#endif
+
+/** @} */
+
+/** The power states, of which exactly one is current at any time. */
+typedef enum ENERGY_STATE {
+    ENERGY_STATE_ACTIVE,
+    ENERGY_STATE_SLEEP,
+    ENERGY_STATE_DEEPSLEEP,
+    ENERGY_STATE_DEEPPOWERDOWN,
+    ENERGY_STATE_COUNT
+} ENERGY_STATE_T;
+
+/** The long operations, which may overlap with each other and with any power state except Deep Power Down. */
+typedef enum ENERGY_OP {
+    ENERGY_OP_EEPROM,
+    ENERGY_OP_TSEN,
+    ENERGY_OP_NFC,
+    ENERGY_OP_COUNT
+} ENERGY_OP_T;
+
+/** The size in bytes of the payload of the NDEF record created by #Energy_CreateRecord. */
+#define ENERGY_REPORT_SIZE 88
+
+/**
+ * The residency counters accumulated since the last call to #Energy_Reset, up to the moment of the call to
+ * #Energy_GetReport. Also the payload of the NDEF record, with all fields in little endian byte order and without any
+ * padding.
+ */
+typedef struct ENERGY_REPORT_S {
+    uint64_t stateTime[ENERGY_STATE_COUNT]; /**< The time spent in each power state, in us. */
+    uint64_t opTime[ENERGY_OP_COUNT]; /**< The time spent in each long operation, in us. */
+    uint32_t stateCount[ENERGY_STATE_COUNT]; /**< The number of times each power state was entered. */
+    uint32_t opCount[ENERGY_OP_COUNT]; /**< The number of times each long operation was started. */
+    uint32_t charge; /**< The estimated charge drawn from the supply, in uC, according to the energy model. */
+} ENERGY_REPORT_T;
+
+/**
+ * Restores the counters last saved with #Energy_Save, and starts accounting in #ENERGY_STATE_ACTIVE. If no valid
+ * counters are found in EEPROM, the counters are reset.
+ * @param resumed : @c true when the IC woke up from Deep Power Down, and @c dpdEntry is known.
+ * @param dpdEntry : Only used when @c resumed is @c true: the value #Energy_GetDpdEntry returned just before entering
+ *  Deep Power Down. The time since, including booting up to this call, is accounted to Deep Power Down. The time from
+ *  the last #Energy_Save up to @c dpdEntry is accounted as active.
+ * @note Deep Power Down does not save the counters: the operations and power state changes since the last
+ *  #Energy_Save are lost. Save right before allowing Deep Power Down to keep this to a minimum.
+ * @pre #Timer_Init has been called, and the EEPROM driver is initialized.
+ */
+void Energy_Init(bool resumed, uint32_t dpdEntry);
+
+/**
+ * Forgets all counters. The EEPROM copy is not changed until the next call to #Energy_Save.
+ */
+void Energy_Reset(void);
+
+/**
+ * Marks a power state transition: called by the power manager just before entering and right after leaving a low
+ * power mode.
+ * @param state : The new power state. #ENERGY_STATE_DEEPPOWERDOWN also ends all operations. It does not save the
+ *  counters: see #Energy_Init.
+ * @note When Deep Power Down was not entered after all, call this function with #ENERGY_STATE_ACTIVE: the time since
+ *  is then accounted as active, and Deep Power Down is not counted.
+ * @pre Interrupts are disabled.
+ */
+void Energy_Enter(ENERGY_STATE_T state);
+
+/**
+ * Marks the start of a long operation. Nothing changes if the operation was already started.
+ * @param op : The operation.
+ * @note May be called under interrupt.
+ */
+void Energy_Begin(ENERGY_OP_T op);
+
+/**
+ * Marks the end of a long operation. Nothing changes if the operation was not started.
+ * @param op : The operation.
+ * @note May be called under interrupt.
+ */
+void Energy_End(ENERGY_OP_T op);
+
+/**
+ * Retrieves the counters, including the time spent so far in the current state and in running operations.
+ * @param pReport : May not be @c NULL. Will be filled in.
+ */
+void Energy_GetReport(ENERGY_REPORT_T *pReport);
+
+/**
+ * Stores the counters in EEPROM, at #ENERGY_EEPROM_OFFSET, and waits until the EEPROM has been programmed. The time
+ * this takes is accounted to #ENERGY_OP_EEPROM, and is part of the next save.
+ * @note Call this regularly, e.g. together with #TStat_Save: whatever is not saved is lost on a reset.
+ * @pre The EEPROM driver is initialized.
+ */
+void Energy_Save(void);
+
+/**
+ * Retrieves the time of entering Deep Power Down, to be kept in the PMU retained data - e.g. in a checkpoint, see
+ * @ref MODS_LPC8Nxx_CKPT "ckpt" - and to be passed to #Energy_Init after waking up.
+ * @return The current time, in units of 1024 us. Call this from the Deep Power Down callback: see #POWER_DPD_CB_T.
+ * @note Accesses no EEPROM.
+ */
+uint32_t Energy_GetDpdEntry(void);
+
+/**
+ * Adds a MIME record with an #ENERGY_REPORT_T payload to the NDEF message being created.
+ * @param pInstance : The NDEFT2T instance buffer, as given to #NDEFT2T_CreateMessage.
+ * @return @c true when the record was added, @c false if there was not enough space in the message.
+ * @pre #NDEFT2T_CreateMessage has been called.
+ * @post Call #NDEFT2T_CommitMessage when all records have been added.
+ */
+bool Energy_CreateRecord(void *pInstance);
+
+#endif
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+
+#ifndef EVENT_H_
+#define EVENT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * The number of different events. Each event is a bit in the pending-work bitmap: an event is identified by a number
+ * in the range [0, #EVENT_COUNT[. Events with a lower number are handled first.
+ */
+#define EVENT_COUNT 32
+
+/**
+ * Function prototype for an event handler.
+ * @note Called from #Event_Run, never under interrupt. A handler runs to completion: it is not interrupted by another
+ *  handler.
+ */
+typedef void (*EVENT_HANDLER_T)(void);
+
+/**
+ * Initialize the event loop: no events are pending and no handlers are registered.
+ * @pre This must be the first call to this block of code.
+ */
+void Event_Init(void);
+
+/**
+ * Registers the handler for an event.
+ * @param event : The event number, in the range [0, #EVENT_COUNT[.
+ * @param handler : May be @c NULL to ignore the event.
+ */
+void Event_Register(int event, EVENT_HANDLER_T handler);
+
+/**
+ * Marks an event as pending. The handler will be called once by #Event_Run, also if the event is posted multiple times
+ * before that.
+ * @param event : The event number, in the range [0, #EVENT_COUNT[.
+ * @note May be called under interrupt: this is how interrupt handlers defer work to the main thread.
+ */
+void Event_Post(int event);
+
+/**
+ * Prevents #Event_Run from entering Deep Sleep or Deep Power Down. Use this while waiting on an interrupt that is not a Start Logic source
+ * - e.g. a temperature conversion - and thus cannot wake up the IC from Deep Sleep.
+ * Each call must be matched by a call to #Event_UnlockDeepSleep.
+ * @note May be called under interrupt.
+ */
+void Event_LockDeepSleep(void);
+
+/**
+ * Undoes one call to #Event_LockDeepSleep.
+ * @note May be called under interrupt.
+ */
+void Event_UnlockDeepSleep(void);
+
+/**
+ * Retrieves the longest time between the posting of an event and the start of its handler, since #Event_Init.
+ * @param event : The event number, in the range [0, #EVENT_COUNT[.
+ * @return The latency in microseconds, as measured with #Timer_GetFreeRunning.
+ */
+uint32_t Event_GetMaxLatency(int event);
+
+/**
+ * Runs the event loop. Pending events are handled one at a time, lowest event number first. When no event is pending,
+ * the IC goes to the low power mode selected by #Power_Idle until an interrupt occurs. While Deep Sleep is locked, only
+ * Sleep is used.
+ * @note This function never returns.
+ */
+void Event_Run(void);
+
+#endif
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+
+#ifndef PERF_H_
+#define PERF_H_
+
+#include "chip.h"
+
+/**
+ * @name Performance levels
+ * The System Clock frequency in Hz, the number of flash wait states and the flash power mode of each performance
+ * level. A System Clock frequency above 4 MHz needs at least 1 wait state or the flash high power mode. The software
+ * timers need at least 1 MHz.
+ * @{
+ */
+
+#ifndef PERF_LOW_FREQUENCY
+    #define PERF_LOW_FREQUENCY 1000000
+#endif
+#ifndef PERF_LOW_WAITSTATES
+    #define PERF_LOW_WAITSTATES 0
+#endif
+#ifndef PERF_LOW_HIGHPOWER
+    #define PERF_LOW_HIGHPOWER false
+#endif
+
+#ifndef PERF_MEDIUM_FREQUENCY
+    #define PERF_MEDIUM_FREQUENCY 4000000
+#endif
+#ifndef PERF_MEDIUM_WAITSTATES
+    #define PERF_MEDIUM_WAITSTATES 0
+#endif
+#ifndef PERF_MEDIUM_HIGHPOWER
+    #define PERF_MEDIUM_HIGHPOWER false
+#endif
+
+#ifndef PERF_HIGH_FREQUENCY
+    #define PERF_HIGH_FREQUENCY 8000000
+#endif
+#ifndef PERF_HIGH_WAITSTATES
+    #define PERF_HIGH_WAITSTATES 1
+#endif
+#ifndef PERF_HIGH_HIGHPOWER
+    #define PERF_HIGH_HIGHPOWER false
+#endif
+
+/** @} */
+
+/** The maximum number of hooks that can be registered with #Perf_RegisterHook. */
+#ifndef PERF_MAX_HOOKS
+    #define PERF_MAX_HOOKS 4
+#endif
+
+/** The performance levels, from slow to fast. */
+typedef enum PERF_LEVEL {
+    PERF_LEVEL_LOW,
+    PERF_LEVEL_MEDIUM,
+    PERF_LEVEL_HIGH,
+    PERF_LEVEL_COUNT
+} PERF_LEVEL_T;
+
+/**
+ * Function prototype to retune a peripheral whose timing depends on the System Clock frequency.
+ * @param before : @c true when called right before the switch, still at the old frequency: capture the settings to
+ *  keep, or finish what must not see the switch. @c false when called right after the switch.
+ * @param frequency : The new System Clock frequency in Hz.
+ * @note Called with interrupts disabled.
+ */
+typedef void (*PERF_HOOK_T)(bool before, int frequency);
+
+/**
+ * Switches to a performance level, without calling any hook: the peripherals depending on the System Clock must not
+ * have been initialized yet.
+ * @param level : The initial performance level.
+ * @note Call this first thing after start up, before #Timer_Init and #Chip_EEPROM_Init.
+ */
+void Perf_Init(PERF_LEVEL_T level);
+
+/**
+ * Registers a hook, called on every change of the performance level.
+ * @param hook : May not be @c NULL. At most #PERF_MAX_HOOKS hooks can be registered.
+ */
+void Perf_RegisterHook(PERF_HOOK_T hook);
+
+/**
+ * Switches to a performance level. Next to the System Clock divider, flash wait states and the flash power mode, all
+ * that depends on the System Clock frequency is retuned:
+ * - the EEPROM ref. clock divider, after waiting for an ongoing flush;
+ * - the prescaler of the 32-bit timer, see #Timer_UpdateClock;
+ * - the I2C bit rate, when the I2C clock is enabled;
+ * - the SPI0 clock divider, which must equal the System Clock divider, and the SSP bit rate - after the TX FIFO has
+ *  been sent - when the SPI0 clock is enabled;
+ * - whatever the registered hooks take care of.
+ * .
+ * #Chip_Clock_System_BusyWait_us needs no retuning.
+ * @param level : The new performance level.
+ * @return The previous performance level: to return to after a burst of work.
+ * @note Takes about 100 us with interrupts disabled, plus the time to finish an ongoing EEPROM flush.
+ */
+PERF_LEVEL_T Perf_SetLevel(PERF_LEVEL_T level);
+
+/**
+ * @return The current performance level.
+ */
+PERF_LEVEL_T Perf_GetLevel(void);
+
+#endif
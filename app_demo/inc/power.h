@@ -0,0 +1,179 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+
+#ifndef POWER_H_
+#define POWER_H_
+
+#include "chip.h"
+
+/**
+ * @name Energy model
+ * The cost of each low power mode, as a supply current while in the mode and a charge spent once to enter and leave
+ * it. The cost of an idle period of @c t microseconds in a mode is then <tt>current * t + transition</tt>.
+ * The default values are typical figures at 3 V and a system clock of 1 MHz. They are meant to get the trade-offs
+ * right, not to predict battery life: measure the board and override them in app_sel.h where needed.
+ * @{
+ */
+
+/** Supply current while running, in nA. Only used for reporting, see #Energy_GetReport. */
+#ifndef POWER_ACTIVE_CURRENT
+    #define POWER_ACTIVE_CURRENT 400000
+#endif
+
+/** Supply current in Sleep, in nA: the ARM core is halted, flash and all clocks keep running. */
+#ifndef POWER_SLEEP_CURRENT
+    #define POWER_SLEEP_CURRENT 150000
+#endif
+
+/** Charge to enter and leave Sleep, in pC. */
+#ifndef POWER_SLEEP_TRANSITION
+    #define POWER_SLEEP_TRANSITION 0
+#endif
+
+/** Time to leave Sleep, in us. */
+#ifndef POWER_SLEEP_LATENCY
+    #define POWER_SLEEP_LATENCY 0
+#endif
+
+/** Supply current in Deep Sleep, in nA: the analog blocks and flash are powered down, the SFRO keeps running. */
+#ifndef POWER_DEEPSLEEP_CURRENT
+    #define POWER_DEEPSLEEP_CURRENT 2600
+#endif
+
+/** Charge to enter and leave Deep Sleep, in pC: mainly powering up the flash again. */
+#ifndef POWER_DEEPSLEEP_TRANSITION
+    #define POWER_DEEPSLEEP_TRANSITION 100000
+#endif
+
+/** Time to leave Deep Sleep, in us. */
+#ifndef POWER_DEEPSLEEP_LATENCY
+    #define POWER_DEEPSLEEP_LATENCY 100
+#endif
+
+/** Supply current in Deep Power Down, in nA: only the PMU and the RTC are powered. */
+#ifndef POWER_DEEPPOWERDOWN_CURRENT
+    #define POWER_DEEPPOWERDOWN_CURRENT 120
+#endif
+
+/**
+ * Charge to enter and leave Deep Power Down, in pC: after waking up, the IC boots and runs Init() again, and all state
+ * kept in RAM has to be restored.
+ */
+#ifndef POWER_DEEPPOWERDOWN_TRANSITION
+    #define POWER_DEEPPOWERDOWN_TRANSITION 5000000
+#endif
+
+/** Time to leave Deep Power Down, in us: up to the moment the application can run again. */
+#ifndef POWER_DEEPPOWERDOWN_LATENCY
+    #define POWER_DEEPPOWERDOWN_LATENCY 5000
+#endif
+
+/** Charge to erase and program one EEPROM row, in pC: about 3 ms at #ENERGY_EEPROM_CURRENT. */
+#ifndef POWER_EEPROM_ROW_CHARGE
+    #define POWER_EEPROM_ROW_CHARGE 1800000
+#endif
+
+/**
+ * The number of EEPROM rows programmed on the way to Deep Power Down, on average: e.g. by a Deep Power Down callback
+ * saving data, or a checkpoint that does not fit in the PMU retained data. The power manager itself programs none.
+ * Their charge is added to #POWER_DEEPPOWERDOWN_TRANSITION when selecting a mode; it is not part of the transition in
+ * #Energy_GetReport, where the programming time is accounted to #ENERGY_OP_EEPROM instead.
+ */
+#ifndef POWER_DEEPPOWERDOWN_EEPROM_ROWS
+    #define POWER_DEEPPOWERDOWN_EEPROM_ROWS 0
+#endif
+
+/** @} */
+
+/** The low power modes, from light to deep. */
+typedef enum POWER_STATE {
+    POWER_STATE_SLEEP,
+    POWER_STATE_DEEPSLEEP,
+    POWER_STATE_DEEPPOWERDOWN,
+    POWER_STATE_COUNT
+} POWER_STATE_T;
+
+/**
+ * Function prototype to save the application state before entering Deep Power Down.
+ * @return @c false to refuse Deep Power Down: Deep Sleep is used instead.
+ * @note Even after returning @c true, Deep Power Down is not entered when an interrupt is pending: the IC then
+ *  continues to run with its RAM content intact. See #Power_Idle.
+ * @note Called with interrupts disabled. RAM content is lost after this call: what is needed after waking up must be
+ *  stored in the PMU retained data (#Chip_PMU_SetRetainedData) or in EEPROM.
+ */
+typedef bool (*POWER_DPD_CB_T)(void);
+
+/**
+ * Initialize the power manager: only the RTC can wake up the IC, and Deep Power Down is not allowed.
+ * @pre #Timer_Init has been called.
+ */
+void Power_Init(void);
+
+/**
+ * Selects what, besides the software timers, must be able to wake up the IC.
+ * @param sources : The Start Logic sources to enable in Deep Sleep: #SYSCON_STARTSOURCE_NFC and/or PIO pins.
+ *  #SYSCON_STARTSOURCE_RTC is always enabled. Configure the edges of PIO sources with
+ *  #Chip_SysCon_StartLogic_SetPIORisingEdge.
+ * @param wakeupPin : @c true to have the WAKEUP pin wake up the IC from Deep Power Down.
+ * @note Deep Power Down is never used when a PIO pin is a wake source: only the RTC, an NFC field and the WAKEUP pin
+ *  can end Deep Power Down.
+ * @note The Start Logic interrupt of each PIO source is enabled, and is left pending after Deep Sleep: its handler
+ *  - e.g. #PIO0_0_IRQHandler - must clear the Start Logic status of the pin. The gpioev mod provides these handlers.
+ */
+void Power_SetWakeSources(SYSCON_STARTSOURCE_T sources, bool wakeupPin);
+
+/**
+ * Allows or prevents the use of Deep Power Down.
+ * @param cb : Called just before entering Deep Power Down, to save the application state. @c NULL prevents the use of
+ *  Deep Power Down.
+ * @param enableSwitching : Passed to #Chip_PMU_PowerMode_EnterDeepPowerDown.
+ */
+void Power_SetDeepPowerDown(POWER_DPD_CB_T cb, bool enableSwitching);
+
+/**
+ * Calculates the charge spent when idling in a low power mode.
+ * @param state : The low power mode.
+ * @param idle : The length of the idle period in us.
+ * @return The charge in fC, including the cost of entering and leaving the mode.
+ * @note Accesses no hardware: schedules can be compared with this function before deploying them.
+ */
+uint64_t Power_GetCost(POWER_STATE_T state, uint32_t idle);
+
+/**
+ * Selects the cheapest low power mode to wait for the next wake-up in, according to the energy model.
+ * A mode is only considered when it can be left in time for the first software timer, and when all wake sources in
+ * use can end it:
+ * - Sleep can always be used;
+ * - Deep Sleep cannot be used while a software timer runs on the 32-bit timer;
+ * - Deep Power Down additionally needs #Power_SetDeepPowerDown and no PIO wake sources.
+ * .
+ * @param deepest : The deepest mode the caller allows, e.g. #POWER_STATE_SLEEP while waiting on an interrupt that is
+ *  not a Start Logic source.
+ * @return The selected mode.
+ */
+POWER_STATE_T Power_Select(POWER_STATE_T deepest);
+
+/**
+ * Enters the cheapest low power mode (see #Power_Select) until the next interrupt. Start Logic and the WAKEUP pin are
+ * configured first. Entering and leaving the mode are reported to #Energy_Enter.
+ * After Deep Sleep, #Timer_SyncTimestamp is called to account for the time the 32-bit timer was halted: leaving Deep
+ * Sleep thus takes up to 100 us longer.
+ * @param deepest : The deepest mode the caller allows.
+ * @return The mode that was used. Never returns after entering Deep Power Down: #POWER_STATE_DEEPPOWERDOWN is only
+ *  returned when an interrupt was pending already, and Deep Power Down was not entered after all. No time was spent
+ *  idle then - the Deep Power Down callback was called, though - and the caller must check for new events first.
+ * @pre Interrupts are disabled, so that no interrupt is missed between deciding to idle and entering the mode.
+ */
+POWER_STATE_T Power_Idle(POWER_STATE_T deepest);
+
+#endif
@@ -17,17 +17,134 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+/**
+ * Timeouts of at least this many milliseconds are handled by the RTC "wake-up down-counter", with a resolution of one
+ * second. Shorter timeouts are handled by a match register of the 32-bit timer, with a resolution of one microsecond.
+ * The RTC keeps counting in Deep Sleep and Deep Power Down, and wakes up the IC when it expires. The 32-bit timer
+ * runs from the System Clock, which is stopped in Deep Sleep: it halts, and its interrupt cannot wake up the IC.
+ */
+#ifndef TIMER_RTC_THRESHOLD
+    #define TIMER_RTC_THRESHOLD 2000
+#endif
+
+/**
+ * Function prototype for a timer callback.
+ * @param context : The value given in #Timer_Start.
+ * @note Called under interrupt: from within the 32-bit timer or the RTC interrupt handler.
+ */
+typedef void (*TIMER_CB_T)(uint32_t context);
+
+/**
+ * A software timer. The memory is owned by the caller; all fields are private to the timer service.
+ * @note Static storage is required: a running timer is part of a linked list until it expires or is stopped.
+ */
+typedef struct TIMER_S {
+    struct TIMER_S *pNext;
+    uint32_t expiry; /**< In microseconds (32-bit timer value) or in seconds (RTC time up-counter value). */
+    uint32_t latest; /**< @c expiry plus the allowed slack, in the same unit. */
+    TIMER_CB_T cb;
+    uint32_t context;
+    uint8_t state; /**< Stopped, or in which queue the timer is waiting. */
+} TIMER_T;
+
+/** Timer wake-up statistics, see #Timer_GetStats. */
+typedef struct TIMER_STATS_S {
+    uint32_t seconds; /**< The time over which the statistics were gathered. */
+    uint32_t expiries; /**< The number of expired timers: the number of wake-ups without coalescing, at most. */
+    uint32_t wakeups; /**< The number of timer interrupts in which at least one timer expired. */
+    uint32_t expiriesPerHour; /**< @c expiries, scaled to one hour. */
+    uint32_t wakeupsPerHour; /**< @c wakeups, scaled to one hour. */
+} TIMER_STATS_T;
+
 /**
  * Initialize the timers so that the other function calls become available.
+ * The 32-bit timer is started and keeps running: it is the time base for all timeouts shorter than
+ * #TIMER_RTC_THRESHOLD. No interrupt fires while no timer is running: there is no periodic tick.
  * @pre This must be the first call to this block of code.
+ * @pre The system clock frequency is a multiple of 1 MHz.
  */
 void Timer_Init(void);
 
 /* -------------------------------------------------------------------------------- */
 
+/**
+ * Starts or restarts a software timer. All running timers are kept in two queues, sorted on expiry: one for the
+ * 32-bit timer and one for the RTC. Only the first timer of each queue is programmed in hardware, so the CPU is only
+ * woken up when a timer actually expires.
+ * @param pTimer : May not be @c NULL. If the timer is already running, it is stopped first.
+ * @param ms : The timeout interval in milliseconds. Must be at least 1 and less than 2^31 / 1000.
+ * @param cb : May not be @c NULL. Called under interrupt when the timer expires.
+ * @param context : Passed as-is to @c cb.
+ * @note A timer that is to repeat can restart itself from within its callback.
+ * @note Equal to #Timer_StartWithSlack with a slack of @c 0.
+ */
+void Timer_Start(TIMER_T *pTimer, uint32_t ms, TIMER_CB_T cb, uint32_t context);
+
+/**
+ * Starts or restarts a software timer which may expire later than requested, so that its wake-up can be shared.
+ * The timer expires somewhere in the window [@c ms, @c ms + @c slack]. The hardware is programmed for the earliest
+ * end of all windows; when it fires, all timers whose window has opened expire together. Deadlines that fall within
+ * each other's windows thus cost a single wake-up.
+ * Give periodic activities that need not be punctual - flushing a log, refreshing an NDEF message, feeding a watchdog -
+ * a slack that is a sizeable part of their interval.
+ * @param pTimer : May not be @c NULL. If the timer is already running, it is stopped first.
+ * @param ms : The minimum timeout interval in milliseconds. Must be at least 1 and less than 2^31 / 1000. This also
+ *  selects the hardware timer: see #TIMER_RTC_THRESHOLD.
+ * @param slack : The additional time in milliseconds the timer may expire later. For timers on the RTC, this is
+ *  rounded down to whole seconds. @c ms + @c slack must be less than 2^31 / 1000.
+ * @param cb : May not be @c NULL. Called under interrupt when the timer expires.
+ * @param context : Passed as-is to @c cb.
+ * @note Timers on the 32-bit timer whose window has opened also expire when an RTC timer wakes up the CPU.
+ */
+void Timer_StartWithSlack(TIMER_T *pTimer, uint32_t ms, uint32_t slack, TIMER_CB_T cb, uint32_t context);
+
+/**
+ * Stops a software timer.
+ * @param pTimer : May not be @c NULL. Nothing happens if the timer is not running.
+ * @post The callback of this timer will not be called, unless the timer is started again.
+ */
+void Timer_Stop(TIMER_T *pTimer);
+
+/**
+ * Check if a software timer is running.
+ * @param pTimer : May not be @c NULL.
+ * @return @c true when the timer is started and has not yet expired or been stopped.
+ */
+bool Timer_IsRunning(const TIMER_T *pTimer);
+
+/**
+ * Check if any software timer is running on the 32-bit timer.
+ * @return @c true when at least one running timer was started with a timeout shorter than #TIMER_RTC_THRESHOLD. The
+ *  IC must then not enter Deep Sleep: the interrupt of the 32-bit timer is not a Start Logic source.
+ */
+bool Timer_IsFastRunning(void);
+
+/**
+ * Retrieves the time until the hardware has to wake up the IC for the first running software timer, i.e. the latest
+ * allowed expiry of the first timer.
+ * @return The time in microseconds, saturated to 0xFFFFFFFF. @c 0xFFFFFFFF when no timer is running, @c 0 when a
+ *  timer is about to expire.
+ * @note Reads no RTC register: for timers on the RTC, the result is based on #Timer_GetTimestamp, and accurate up to
+ *  one second.
+ */
+uint32_t Timer_GetIdleTime(void);
+
+/**
+ * Retrieves how many wake-ups the software timers caused, and how many there would have been without coalescing.
+ * @param pStats : May not be @c NULL. Will be filled in.
+ */
+void Timer_GetStats(TIMER_STATS_T *pStats);
+
+/**
+ * Restarts gathering the statistics reported by #Timer_GetStats.
+ */
+void Timer_ResetStats(void);
+
+/* -------------------------------------------------------------------------------- */
+
 /**
  * Starts or restarts a timer.
- * @note The 16-bit timer is used. It will run as slow as possible.
+ * @note A software timer is used: see #Timer_Start.
  * @param seconds The timeout interval. After this many seconds an interrupt will be fired and handled internally.
  *  Use #Timer_StopHostTimeout to check the status.
  * @pre @c seconds must be a struct positive number
@@ -35,7 +152,7 @@ void Timer_Init(void);
 void Timer_StartHostTimeout(int seconds);
 
 /**
- * Stops the 16-bit timer.
+ * Stops the host timeout timer.
  * @post A call to #Timer_CheckHostTimeout will now return @c false.
  */
 void Timer_StopHostTimeout(void);
@@ -44,7 +161,7 @@ void Timer_StopHostTimeout(void);
  * Check if the interrupt has been fired or not.
  * @return @c True when the timer was started and the interrupt was fired. @c false otherwise.
  * @note After the interrupt was fired, an explicit call to #Timer_StartHostTimeout is required to restart the
- *  16-bit timer.
+ *  timer.
  */
 bool Timer_CheckHostTimeout(void);
 
@@ -52,8 +169,9 @@ bool Timer_CheckHostTimeout(void);
 
  /**
  * Starts or restarts a timer.
- * @note The RTC timer is used, which will continue running when going to the Deep Power Down mode, and wake up the IC
- *  when it expires.
+ * @note A software timer on the RTC is used, which will continue running when going to the Deep Power Down mode,
+ *  and wake up the IC when it expires. A wake-up from Deep Power Down by the RTC is reported as an expired
+ *  measurement timeout.
  * @param seconds The timeout interval. After this many seconds an interrupt will be fired and handled internally.
  *  Use #Timer_CheckMeasurementTimeout to check the status.
  * @pre @c seconds must be a positive number. If equal to 0, the previously set value is used. If this is the first
@@ -63,7 +181,7 @@ bool Timer_CheckHostTimeout(void);
 void Timer_StartMeasurementTimeout(int seconds);
 
 /**
- * Stops the RTC timer.
+ * Stops the measurement timeout timer.
  * @post An immediate or later call to #Timer_CheckMeasurementTimeout will now return @c false.
  */
 void Timer_StopMeasurementTimeout(void);
@@ -80,21 +198,52 @@ bool Timer_CheckMeasurementTimeout(void);
 
 /**
  * Starts a timer.
- * @note The 32-bit timer is used, without setting any interrupts. It will run as fast as possible.
+ * @note The 32-bit timer is shared with the software timers, and is already running since #Timer_Init: this call
+ *  does nothing. It is kept for compatibility.
  */
 void Timer_StartFreeRunning(void);
 
 /**
  * Stops the 32-bit timer.
- * @post A call to #Timer_GetFreeRunning will now return ??
+ * @note The 32-bit timer is shared with the software timers and is never stopped: this call does nothing. A call to
+ *  #Timer_GetFreeRunning will still return an increasing value.
  */
 void Timer_StopFreeRunning(void);
 
 /**
  * Retrieve the current timer value.
- * @return A positive number. When the moment of calling this function is not determined, the outcome can be used as a
- *  source of entropy.
+ * @return The lower 32 bits of #Timer_GetTimestamp: it increments every microsecond, and wraps around every 71
+ *  minutes. When the moment of calling this function is not determined, the outcome can be used as a source of
+ *  entropy.
  */
 uint32_t Timer_GetFreeRunning(void);
 
+/**
+ * Retrieves a monotonic time stamp, to be used as the common time base for profiling, logging and event stamping.
+ * The 32-bit timer is extended to 64 bits in software by counting its wrap-arounds, and aligned with the RTC
+ * "time up-counter" (see #Chip_RTC_Time_GetValue) by #Timer_Init and #Timer_SyncTimestamp. A time stamp taken
+ * after a Deep Power Down thus continues where the time stamps before it left off, with second-level accuracy.
+ * @return The number of microseconds since the RTC "time up-counter" was 0.
+ * @note Race-free: may be called under interrupt, also with interrupts disabled. Reads no RTC register: it takes a
+ *  few microseconds only.
+ */
+uint64_t Timer_GetTimestamp(void);
+
+/**
+ * Re-aligns #Timer_GetTimestamp with the RTC "time up-counter".
+ * Call this function when the 32-bit timer may have fallen behind, e.g. after its clock was halted or changed. The
+ * time stamp is only ever moved forward: it remains monotonic.
+ * @note This function reads an RTC register, which may take up to 100 us.
+ */
+void Timer_SyncTimestamp(void);
+
+/**
+ * Adapts the prescaler of the 32-bit timer to the current System Clock frequency, so that it keeps counting
+ * microseconds, and calls #Timer_SyncTimestamp.
+ * Call this function right after changing the System Clock frequency: see #Perf_SetLevel.
+ * @pre The System Clock frequency is at least 1 MHz.
+ * @note Up to one microsecond may be lost.
+ */
+void Timer_UpdateClock(void);
+
 #endif
@@ -25,11 +25,18 @@
 #define MSG_ENABLE_GETUID 1
 
 #define TMEAS_CB App_TmeasCb
+#define TMEAS_CELSIUS 1
+#define TMEAS_SENSOR_CORRECTION 0 /**< The calib mod applies the correction in the TSEN calibration parameters. */
 
 #define NDEFT2T_EEPROM_COPY_SUPPPORT 0
 #define NDEFT2T_FIELD_STATUS_CB NDEFT2T_FieldStatus_Cb
 #define NDEFT2T_MSG_AVAILABLE_CB NDEFT2T_MsgAvailable_Cb
 
+#define I2CS_IRQHANDLER 0 /**< The i2cm mod provides #I2C0_IRQHandler and forwards slave transfers. */
+
+#define CKPT_RETAINED_COUNT 4 /**< Leaves the last PMU retained data word to the health monitor. */
+#define HEALTH_RETAINED_WORD 4
+
 //#define STORAGE_TYPE int16_t
 //#define STORAGE_BITSIZE 11 /**< round_up(log_2(2 * APP_MSG_MAX_TEMPERATURE)) */
 //#define STORAGE_SIGNED 1
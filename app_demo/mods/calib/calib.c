@@ -0,0 +1,143 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include "calib.h"
+#include "tmeas/tmeas.h"
+
+#if TMEAS_SENSOR_CORRECTION
+    #error The calib module corrects the sensor itself: TMEAS_SENSOR_CORRECTION must be set to 0
+#endif
+
+/* -------------------------------------------------------------------------
+ * Private types and defines
+ * ------------------------------------------------------------------------- */
+
+/** Marks a valid record in EEPROM. */
+#define CALIB_MAGIC 0xCA1B
+
+/** The calibration values, as kept in RAM and stored in EEPROM. */
+typedef struct CALIB_RECORD_S {
+    uint16_t magic; /**< #CALIB_MAGIC */
+    uint16_t checksum; /**< Makes the 16-bit sum of all half words of the record equal to 0xFFFF. */
+    uint32_t factoryA; /**< The factory value of #LPC_TSEN_T.SP1: unsigned 10.6 fixed point in the lower 16 bits. */
+    uint32_t factoryB; /**< The factory value of #LPC_TSEN_T.SP2: signed 10.6 fixed point in the lower 16 bits. */
+    int16_t gain; /**< The sensor correction gain reduction: see #Calib_SetCorrection. */
+    int16_t offset; /**< The sensor correction offset: see #Calib_SetCorrection. */
+} CALIB_RECORD_T;
+
+/* -------------------------------------------------------------------------
+ * Private function prototypes
+ * ------------------------------------------------------------------------- */
+
+static uint16_t Checksum(const CALIB_RECORD_T *pRecord);
+static void Store(void);
+static int Scale(int value, int gain);
+static void Apply(void);
+
+/* -------------------------------------------------------------------------
+ * Private variables
+ * ------------------------------------------------------------------------- */
+
+static CALIB_RECORD_T sRecord;
+
+/* -------------------------------------------------------------------------
+ * Private functions
+ * ------------------------------------------------------------------------- */
+
+static uint16_t Checksum(const CALIB_RECORD_T *pRecord)
+{
+    const uint16_t *p = (const uint16_t *)pRecord;
+    uint32_t sum = 0;
+    uint32_t i;
+
+    for (i = 0; i < sizeof(CALIB_RECORD_T) / sizeof(uint16_t); i++) {
+        sum += p[i];
+    }
+    sum -= pRecord->checksum;
+    sum = (sum & 0xFFFF) + (sum >> 16);
+    sum = (sum & 0xFFFF) + (sum >> 16);
+    return (uint16_t)~sum;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void Store(void)
+{
+    sRecord.checksum = Checksum(&sRecord);
+    Chip_EEPROM_Write(LPC_EEPROM, CALIB_EEPROM_OFFSET, &sRecord, sizeof(CALIB_RECORD_T));
+    Chip_EEPROM_Flush(LPC_EEPROM, true);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/** Returns value * gain / 65536, rounded to the nearest integer. */
+static int Scale(int value, int gain)
+{
+    /* |value| <= 0xFFFF and |gain| <= 0x7FFF: the product fits in 32 bits. */
+    int product = value * gain;
+    return (product >= 0) ? ((product + 0x8000) / 0x10000) : -((0x8000 - product) / 0x10000);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/** Derives the corrected calibration parameters from the factory values, and writes them to the TSEN HW block. */
+static void Apply(void)
+{
+    int a = (int)(sRecord.factoryA & 0xFFFF);
+    int b = (int16_t)(sRecord.factoryB & 0xFFFF);
+
+    a = a - Scale(a, sRecord.gain);
+    b = b - Scale(b, sRecord.gain) + sRecord.offset;
+    ASSERT((a >= 0) && (a <= 0xFFFF));
+    ASSERT((b >= -0x8000) && (b <= 0x7FFF));
+
+    Chip_TSen_Init(LPC_TSEN);
+    LPC_TSEN->SP1 = (sRecord.factoryA & ~0xFFFFu) | (uint32_t)a;
+    LPC_TSEN->SP2 = (sRecord.factoryB & ~0xFFFFu) | (uint16_t)b;
+    Chip_TSen_DeInit(LPC_TSEN);
+}
+
+/* -------------------------------------------------------------------------
+ * Exported functions
+ * ------------------------------------------------------------------------- */
+
+void Calib_Init(void)
+{
+    Chip_EEPROM_Read(LPC_EEPROM, CALIB_EEPROM_OFFSET, &sRecord, sizeof(CALIB_RECORD_T));
+    if ((sRecord.magic != CALIB_MAGIC) || (sRecord.checksum != Checksum(&sRecord))) {
+        /* Only here the boot ROM is called. */
+        sRecord.magic = CALIB_MAGIC;
+        sRecord.factoryA = Chip_IAP_ReadFactorySettings((uint32_t)&LPC_TSEN->SP1);
+        sRecord.factoryB = Chip_IAP_ReadFactorySettings((uint32_t)&LPC_TSEN->SP2);
+        sRecord.gain = CALIB_CORRECTION_GAIN_DEFAULT;
+        sRecord.offset = CALIB_CORRECTION_OFFSET_DEFAULT;
+        Store();
+    }
+    Apply();
+}
+
+/* ------------------------------------------------------------------------- */
+
+void Calib_SetCorrection(int gain, int offset)
+{
+    ASSERT((gain >= -0x7FFF) && (gain <= 0x7FFF));
+    ASSERT((offset >= -0x7FFF) && (offset <= 0x7FFF));
+    ASSERT(sRecord.magic == CALIB_MAGIC);
+    sRecord.gain = (int16_t)gain;
+    sRecord.offset = (int16_t)offset;
+    Store();
+    Apply();
+}
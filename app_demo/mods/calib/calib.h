@@ -0,0 +1,72 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __CALIB_H_
+#define __CALIB_H_
+
+/** @defgroup MODS_LPC8Nxx_CALIB calib: Temperature sensor calibration module
+ * @ingroup MODS_LPC8Nxx
+ * The calibration module applies a per-device correction to the temperature sensor, straight in the TSEN calibration
+ * parameters @c a and @c b: #LPC_TSEN_T.SP1 and #LPC_TSEN_T.SP2.
+ *
+ * The TSEN HW block calculates a temperature N = a * mu + b, with mu the ratio it measured. A correction
+ *  N -> N - N * gain / 65536 + offset
+ * is thus equal to a measurement with the parameters
+ *  a -> a - a * gain / 65536, and
+ *  b -> b - b * gain / 65536 + offset
+ * This costs nothing per measurement, and, with the default parameters, is more accurate than the fixed correction
+ * of the @ref MODS_LPC8Nxx_TMEAS "tmeas" module, which must be disabled: see @ref TMEAS_SENSOR_CORRECTION.
+ *
+ * The factory values of @c a and @c b are read with #Chip_IAP_ReadFactorySettings only once: at the very first start
+ * up. That call enters the boot ROM, and tears down and re-initializes the EEPROM driver. The factory values are
+ * stored together with the correction in a small checksummed EEPROM record, from which the corrected parameters are
+ * derived at each start up - including after each wake-up from Deep Power Down.
+ *
+ * @par Diversity
+ *  This module supports diversity, like the location of the record in EEPROM.
+ *  Check @ref MODS_LPC8Nxx_CALIB_DFT for all diversity parameters.
+ *
+ * @{
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include "chip.h"
+#include "app_sel.h"
+#include "calib_dft.h"
+
+/* -------------------------------------------------------------------------
+ * Exported function prototypes
+ * ------------------------------------------------------------------------- */
+
+/**
+ * Initializes the module, and applies the stored sensor correction to the TSEN calibration parameters.
+ * If no valid record is found in EEPROM, the factory values are read using #Chip_IAP_ReadFactorySettings, and a new
+ * record is written with #CALIB_CORRECTION_GAIN_DEFAULT and #CALIB_CORRECTION_OFFSET_DEFAULT.
+ * @pre The EEPROM driver is initialized.
+ * @pre No temperature measurement is in progress.
+ */
+void Calib_Init(void);
+
+/**
+ * Sets, stores and applies a sensor correction determined for this device, e.g. by a reference measurement during
+ * production. It is kept in EEPROM, and applied again by #Calib_Init at each start up.
+ * @param gain : The gain reduction, in units of 1/65536. Must be in the range [-0x7FFF, 0x7FFF].
+ * @param offset : The offset, in native units (1/64 Kelvin). Must be in the range [-0x7FFF, 0x7FFF].
+ * @pre #Calib_Init has been called.
+ * @pre No temperature measurement is in progress.
+ */
+void Calib_SetCorrection(int gain, int offset);
+
+#endif /** @} */
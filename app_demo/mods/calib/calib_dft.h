@@ -0,0 +1,53 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __CALIB_DFT_H_
+#define __CALIB_DFT_H_
+
+/** @defgroup MODS_LPC8Nxx_CALIB_DFT Diversity Settings
+ *  @ingroup MODS_LPC8Nxx_CALIB
+ * These 'defines' capture the diversity settings of the module. The displayed values refer to the default settings.
+ * To override the default settings, place the defines with their desired values in the application app_sel.h header
+ * file: the compiler will pick up your defines before parsing this file.
+ * @{
+ */
+
+/**
+ * The offset, in bytes, in EEPROM where the calibration record is stored. The record occupies 16 bytes.
+ * By default, the one but last writable EEPROM row is used.
+ */
+#if (!defined(CALIB_EEPROM_OFFSET))
+    #define CALIB_EEPROM_OFFSET ((EEPROM_NR_OF_RW_ROWS - 2) * EEPROM_ROW_SIZE)
+#endif
+
+/**
+ * The gain reduction of the sensor correction used until #Calib_SetCorrection is called, in units of 1/65536.
+ * The default value corrects the deviation common to all sensors: for a value C in degrees Celsius,
+ *  C -> C * (1 - 0.6/85), with 65536 * 0.6/85 = 462.6
+ */
+#if (!defined(CALIB_CORRECTION_GAIN_DEFAULT))
+    #define CALIB_CORRECTION_GAIN_DEFAULT 463
+#endif
+
+/**
+ * The offset of the sensor correction used until #Calib_SetCorrection is called, in native units (1/64 Kelvin).
+ * The default value goes with #CALIB_CORRECTION_GAIN_DEFAULT: (273.15 * 64) * 0.6/85 = 123.4
+ */
+#if (!defined(CALIB_CORRECTION_OFFSET_DEFAULT))
+    #define CALIB_CORRECTION_OFFSET_DEFAULT 123
+#endif
+
+/**
+ * @}
+ */
+
+#endif
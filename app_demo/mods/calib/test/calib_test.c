@@ -0,0 +1,188 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/*
+ * Host test of the calib mod. A measurement with the parameters written by the mod must equal the corrected value of a
+ * measurement with the factory parameters, closer to the exact correction than the fixed one of the tmeas mod. The
+ * boot ROM must be called only at the very first start up.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "calib.h"
+
+/* ------------------------------------------------------------------------- */
+
+/* Factory parameters of the emulated IC: a = 380.0 K and b = -61.5 K, in 10.6 fixed point. b is negative. */
+#define FACTORY_A (380 * 64)
+#define FACTORY_B (-(61 * 64 + 32))
+
+/* Bits next to the parameters, which must be left as they are. */
+#define FACTORY_OTHER_BITS 0xA5000000u
+
+#define CHECK(condition) Check((condition), #condition, __LINE__)
+
+/* ------------------------------------------------------------------------- */
+
+LPC_TSEN_T Test_TSen;
+LPC_EEPROM_T Test_EEPROM;
+
+static int sFailures;
+static int sIapCalls;
+
+/* ------------------------------------------------------------------------- */
+
+static void Check(bool condition, const char *text, int line)
+{
+    if (!condition) {
+        if (sFailures < 20) {
+            printf("FAIL line %d: %s\n", line, text);
+        }
+        sFailures++;
+    }
+}
+
+void Chip_EEPROM_Read(LPC_EEPROM_T *pEEPROM, int offset, void *pBuf, int size)
+{
+    memcpy(pBuf, pEEPROM->data + offset, (size_t)size);
+}
+
+void Chip_EEPROM_Write(LPC_EEPROM_T *pEEPROM, int offset, void *pBuf, int size)
+{
+    memcpy(pEEPROM->data + offset, pBuf, (size_t)size);
+}
+
+void Chip_EEPROM_Flush(LPC_EEPROM_T *pEEPROM, bool wait)
+{
+    (void)pEEPROM;
+    (void)wait;
+}
+
+uint32_t Chip_IAP_ReadFactorySettings(uint32_t address)
+{
+    sIapCalls++;
+    if (address == (uint32_t)(uintptr_t)&Test_TSen.SP1) {
+        return FACTORY_OTHER_BITS | FACTORY_A;
+    }
+    if (address == (uint32_t)(uintptr_t)&Test_TSen.SP2) {
+        return FACTORY_OTHER_BITS | (uint16_t)FACTORY_B;
+    }
+    CHECK(false);
+    return 0;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/** Emulates a start up: the boot ROM loads the factory parameters, after which the mod is initialized. */
+static void Boot(void)
+{
+    Test_TSen.SP1 = FACTORY_OTHER_BITS | FACTORY_A;
+    Test_TSen.SP2 = FACTORY_OTHER_BITS | (uint16_t)FACTORY_B;
+    sIapCalls = 0;
+    Calib_Init();
+}
+
+/** Returns the temperature, in native units, the TSEN HW block calculates with the parameters in its registers. */
+static double Measure(double mu)
+{
+    return (Test_TSen.SP1 & 0xFFFF) * mu + (int16_t)(Test_TSen.SP2 & 0xFFFF);
+}
+
+/**
+ * Returns the largest deviation, in degrees, from the exact correction over the range [-40, +85] degrees Celsius.
+ * @param fixed : When @c true, the fixed correction of the tmeas mod is applied to the factory measurement instead.
+ */
+static double MaxError(bool fixed)
+{
+    double max = 0;
+    double n;
+    double exact;
+    double error;
+    int corrected;
+    int native;
+
+    for (native = (273 - 40) * 64; native <= (273 + 85) * 64; native++) {
+        n = native;
+        exact = n - n * 0.6 / 85 + 273.15 * 64 * 0.6 / 85;
+        if (fixed) {
+            corrected = native - (native / 128) + 137;
+        }
+        else {
+            /* The HW block truncates to an integer native value. */
+            corrected = (int)Measure((n - FACTORY_B) / FACTORY_A);
+        }
+        error = (corrected - exact) / 64;
+        error = (error < 0) ? -error : error;
+        if (error > max) {
+            max = error;
+        }
+    }
+    return max;
+}
+
+/* ------------------------------------------------------------------------- */
+
+int main(void)
+{
+    double fixedError = MaxError(true);
+    double calibError;
+    uint32_t sp1;
+    uint32_t sp2;
+
+    memset(&Test_EEPROM, 0xFF, sizeof(Test_EEPROM));
+
+    /* First start up: the factory parameters are read once, and a corrected version is applied. */
+    Boot();
+    CHECK(sIapCalls == 2);
+    CHECK(Test_TSen.SP1 == (FACTORY_OTHER_BITS | (FACTORY_A - 172))); /* 24320 * 463 / 65536 = 171.8 */
+    CHECK(Test_TSen.SP2 == (FACTORY_OTHER_BITS | (uint16_t)(FACTORY_B + 28 + 123))); /* -3936 * 463 / 65536 = -27.8 */
+    calibError = MaxError(false);
+    printf("Maximum error in [-40, +85] C: %.4f C with the calib mod, %.4f C with the fixed correction\n",
+           calibError, fixedError);
+    CHECK(calibError < 0.03);
+    CHECK(calibError < fixedError);
+
+    /* Every next start up - also after Deep Power Down - works from EEPROM alone. */
+    sp1 = Test_TSen.SP1;
+    sp2 = Test_TSen.SP2;
+    Boot();
+    CHECK(sIapCalls == 0);
+    CHECK(Test_TSen.SP1 == sp1);
+    CHECK(Test_TSen.SP2 == sp2);
+
+    /* A per-device correction is applied right away, and kept. No correction restores the factory parameters. */
+    Calib_SetCorrection(0, 0);
+    CHECK(Test_TSen.SP1 == (FACTORY_OTHER_BITS | FACTORY_A));
+    CHECK(Test_TSen.SP2 == (FACTORY_OTHER_BITS | (uint16_t)FACTORY_B));
+    Boot();
+    CHECK(sIapCalls == 0);
+    CHECK(Test_TSen.SP1 == (FACTORY_OTHER_BITS | FACTORY_A));
+    CHECK(Test_TSen.SP2 == (FACTORY_OTHER_BITS | (uint16_t)FACTORY_B));
+
+    Calib_SetCorrection(-1000, 64);
+    CHECK(Test_TSen.SP1 == (FACTORY_OTHER_BITS | (FACTORY_A + 371))); /* 24320 * 1000 / 65536 = 371.1 */
+    CHECK(Test_TSen.SP2 == (FACTORY_OTHER_BITS | (uint16_t)(FACTORY_B - 60 + 64))); /* -3936 * 1000 / 65536 = -60.1 */
+
+    /* A corrupted record is replaced, with the default correction. */
+    Test_EEPROM.data[CALIB_EEPROM_OFFSET + 6] ^= 1;
+    Boot();
+    CHECK(sIapCalls == 2);
+    CHECK(Test_TSen.SP1 == sp1);
+    CHECK(Test_TSen.SP2 == sp2);
+
+    if (sFailures) {
+        printf("calib: %d checks failed\n", sFailures);
+        return 1;
+    }
+    printf("calib: all tests passed\n");
+    return 0;
+}
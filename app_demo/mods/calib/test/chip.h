@@ -0,0 +1,63 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/* Host stand-in for the chip library: only what the calib mod uses. The real tsen driver is built on top of a
+ * register block in RAM; the EEPROM and the boot ROM are emulated by the test. */
+
+#ifndef __CHIP_H_
+#define __CHIP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <assert.h>
+
+#define ASSERT(expression) assert(expression)
+
+#define __I volatile const
+#define __O volatile
+#define __IO volatile
+
+#define EEPROM_ROW_SIZE 64
+#define EEPROM_NR_OF_RW_ROWS 58
+
+typedef enum SYSCON_PERIPHERAL_POWER {
+    SYSCON_PERIPHERAL_POWER_TSEN
+} SYSCON_PERIPHERAL_POWER_T;
+
+typedef enum CLOCK_PERIPHERAL {
+    CLOCK_PERIPHERAL_TSEN
+} CLOCK_PERIPHERAL_T;
+
+static inline void Chip_SysCon_Peripheral_EnablePower(SYSCON_PERIPHERAL_POWER_T power) { (void)power; }
+static inline void Chip_SysCon_Peripheral_DisablePower(SYSCON_PERIPHERAL_POWER_T power) { (void)power; }
+static inline void Chip_Clock_Peripheral_EnableClock(CLOCK_PERIPHERAL_T clock) { (void)clock; }
+static inline void Chip_Clock_Peripheral_DisableClock(CLOCK_PERIPHERAL_T clock) { (void)clock; }
+
+#include "tsen_8Nxx.h"
+
+extern LPC_TSEN_T Test_TSen;
+#define LPC_TSEN (&Test_TSen)
+
+typedef struct LPC_EEPROM_S {
+    uint8_t data[EEPROM_NR_OF_RW_ROWS * EEPROM_ROW_SIZE];
+} LPC_EEPROM_T;
+
+extern LPC_EEPROM_T Test_EEPROM;
+#define LPC_EEPROM (&Test_EEPROM)
+
+void Chip_EEPROM_Read(LPC_EEPROM_T *pEEPROM, int offset, void *pBuf, int size);
+void Chip_EEPROM_Write(LPC_EEPROM_T *pEEPROM, int offset, void *pBuf, int size);
+void Chip_EEPROM_Flush(LPC_EEPROM_T *pEEPROM, bool wait);
+uint32_t Chip_IAP_ReadFactorySettings(uint32_t address);
+
+#endif
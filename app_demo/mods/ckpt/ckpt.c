@@ -0,0 +1,161 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include <string.h>
+#include "ckpt.h"
+
+#if (CKPT_RETAINED_COUNT < 1) || (CKPT_RETAINED_FIRST < 0) || (CKPT_RETAINED_FIRST + CKPT_RETAINED_COUNT > 5)
+    #error CKPT_RETAINED_FIRST and CKPT_RETAINED_COUNT must select a range of the 5 PMU retained data words
+#endif
+
+/* -------------------------------------------------------------------------
+ * Private types and defines
+ * ------------------------------------------------------------------------- */
+
+/** Mixed into the checksum: an all zero retained data section - as after a power-on reset - is never valid. */
+#define CKPT_SEED 0xC4C4
+
+/** The resolution of the active time in the header, in microseconds. */
+#define ACTIVE_TIME_UNIT 100
+
+/**
+ * The complete retained data section used by this module.
+ * The header holds the checksum in the lower half word and the active time in the upper half word.
+ */
+typedef struct CKPT_RETAINED_S {
+    uint32_t header;
+    uint32_t data[CKPT_RETAINED_COUNT - 1];
+} CKPT_RETAINED_T;
+
+/* -------------------------------------------------------------------------
+ * Private function prototypes
+ * ------------------------------------------------------------------------- */
+
+static uint16_t Checksum(const uint8_t *pData, int size);
+
+/* -------------------------------------------------------------------------
+ * Private variables
+ * ------------------------------------------------------------------------- */
+
+static PMU_DPD_WAKEUPREASON_T sReason = PMU_DPD_WAKEUPREASON_NONE;
+
+/** The upper half word of the header found by #Ckpt_Restore. */
+static uint16_t sActiveTime = 0;
+
+/* -------------------------------------------------------------------------
+ * Private functions
+ * ------------------------------------------------------------------------- */
+
+/** The size is part of the checksum, so that a change in layout invalidates the checkpoint. */
+static uint16_t Checksum(const uint8_t *pData, int size)
+{
+    uint32_t sum = CKPT_SEED + (uint32_t)size;
+    int i;
+
+    for (i = 0; i < size; i++) {
+        sum += (uint32_t)pData[i] << ((i & 1) * 8);
+    }
+    sum = (sum & 0xFFFF) + (sum >> 16);
+    sum = (sum & 0xFFFF) + (sum >> 16);
+    return (uint16_t)~sum;
+}
+
+/* -------------------------------------------------------------------------
+ * Exported functions
+ * ------------------------------------------------------------------------- */
+
+void Ckpt_Init(void)
+{
+    sReason = Chip_PMU_PowerMode_GetDPDWakeupReason();
+    sActiveTime = 0;
+}
+
+/* ------------------------------------------------------------------------- */
+
+PMU_DPD_WAKEUPREASON_T Ckpt_GetWakeupReason(void)
+{
+    return sReason;
+}
+
+/* ------------------------------------------------------------------------- */
+
+bool Ckpt_Restore(void *pData, int size)
+{
+    CKPT_RETAINED_T retained;
+    int retainedSize = (size < CKPT_RETAINED_SIZE) ? size : CKPT_RETAINED_SIZE;
+
+    ASSERT(pData != NULL);
+    ASSERT((size > 0) && (size <= CKPT_MAX_SIZE));
+
+    memset(pData, 0, (size_t)size);
+    if (sReason == PMU_DPD_WAKEUPREASON_NONE) {
+        /* The retained data only survives a Deep Power Down: after any other reset it is not to be trusted. */
+        return false;
+    }
+    Chip_PMU_GetRetainedData((uint32_t *)&retained, CKPT_RETAINED_FIRST, CKPT_RETAINED_COUNT);
+    memcpy(pData, retained.data, (size_t)retainedSize);
+    if (size > CKPT_RETAINED_SIZE) {
+        Chip_EEPROM_Read(LPC_EEPROM, CKPT_EEPROM_OFFSET, (uint8_t *)pData + CKPT_RETAINED_SIZE,
+                size - CKPT_RETAINED_SIZE);
+    }
+    if ((retained.header & 0xFFFF) != Checksum(pData, size)) {
+        return false;
+    }
+    sActiveTime = (uint16_t)(retained.header >> 16);
+    return true;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void Ckpt_Save(const void *pData, int size, uint32_t activeTime)
+{
+    CKPT_RETAINED_T retained;
+    uint8_t stored[16];
+    const uint8_t *pOverflow = (const uint8_t *)pData + CKPT_RETAINED_SIZE;
+    int retainedSize = (size < CKPT_RETAINED_SIZE) ? size : CKPT_RETAINED_SIZE;
+    int offset;
+    int chunk;
+    bool changed = false;
+
+    ASSERT(pData != NULL);
+    ASSERT((size > 0) && (size <= CKPT_MAX_SIZE));
+
+    /* Only program the EEPROM when needed: it costs time and wears the EEPROM. */
+    for (offset = 0; !changed && (offset < size - CKPT_RETAINED_SIZE); offset += chunk) {
+        chunk = size - CKPT_RETAINED_SIZE - offset;
+        chunk = (chunk < (int)sizeof(stored)) ? chunk : (int)sizeof(stored);
+        Chip_EEPROM_Read(LPC_EEPROM, CKPT_EEPROM_OFFSET + offset, stored, chunk);
+        changed = (memcmp(stored, pOverflow + offset, (size_t)chunk) != 0);
+    }
+    if (changed) {
+        Chip_EEPROM_Write(LPC_EEPROM, CKPT_EEPROM_OFFSET, (void *)pOverflow, size - CKPT_RETAINED_SIZE);
+        Chip_EEPROM_Flush(LPC_EEPROM, true);
+    }
+
+    activeTime = (activeTime + ACTIVE_TIME_UNIT - 1) / ACTIVE_TIME_UNIT;
+    memset(&retained, 0, sizeof(CKPT_RETAINED_T));
+    memcpy(retained.data, pData, (size_t)retainedSize);
+    retained.header = Checksum(pData, size) | ((activeTime > 0xFFFF ? 0xFFFF : activeTime) << 16);
+    Chip_PMU_SetRetainedData((uint32_t *)&retained, CKPT_RETAINED_FIRST, CKPT_RETAINED_COUNT);
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t Ckpt_GetActiveTime(void)
+{
+    return (uint32_t)sActiveTime * ACTIVE_TIME_UNIT;
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __CKPT_H_
+#define __CKPT_H_
+
+/** @defgroup MODS_LPC8Nxx_CKPT ckpt: Deep Power Down checkpoint module
+ * @ingroup MODS_LPC8Nxx
+ * The checkpoint module keeps a small block of application state - e.g. a log position, a sequence number, the next
+ * deadline and the operating mode - across Deep Power Down.
+ *
+ * After a wake-up from Deep Power Down the IC restarts from the reset handler, and all RAM content is lost. Restoring
+ * the state from EEPROM costs a read of the EEPROM, which must be powered and initialized first. This module instead
+ * packs the state in the PMU retained data words (see #Chip_PMU_SetRetainedData), which survive Deep Power Down and
+ * cost no EEPROM access. Only the data that does not fit there overflows to EEPROM.
+ *
+ * Together with the wake-up reason, this allows an application to take a short path after a Deep Power Down: e.g.
+ * when woken up by the RTC, take one measurement and go back to Deep Power Down, without the full initialization.
+ * To tune that path, the time spent awake - from wake-up to entering Deep Power Down again - is kept in the checkpoint
+ * as well, and reported after the next wake-up by #Ckpt_GetActiveTime.
+ *
+ * @par Diversity
+ *  This module supports diversity, like which retained words and which EEPROM area are used.
+ *  Check @ref MODS_LPC8Nxx_CKPT_DFT for all diversity parameters.
+ *
+ * @par Usage
+ *  - Call #Ckpt_Init first thing after start up, before any Sleep or Deep Sleep: that would clear the wake-up reason.
+ *  - Check #Ckpt_GetWakeupReason and call #Ckpt_Restore to decide on the start up path.
+ *  - Call #Ckpt_Save just before entering Deep Power Down.
+ *  .
+ *
+ * @{
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include "chip.h"
+#include "app_sel.h"
+#include "ckpt_dft.h"
+
+/* -------------------------------------------------------------------------
+ * Types and defines
+ * ------------------------------------------------------------------------- */
+
+/** The number of bytes of checkpoint data that is kept in the PMU retained data words. */
+#define CKPT_RETAINED_SIZE (4 * (CKPT_RETAINED_COUNT - 1))
+
+/** The maximum size of the checkpoint data. */
+#define CKPT_MAX_SIZE (CKPT_RETAINED_SIZE + CKPT_EEPROM_SIZE)
+
+/* -------------------------------------------------------------------------
+ * Exported function prototypes
+ * ------------------------------------------------------------------------- */
+
+/**
+ * Initializes the module: retrieves and keeps the reason of the last wake-up from Deep Power Down.
+ * @pre No Sleep or Deep Sleep has been entered since the start up.
+ */
+void Ckpt_Init(void);
+
+/**
+ * Retrieves the reason of the last wake-up from Deep Power Down, as it was at #Ckpt_Init.
+ * @return #PMU_DPD_WAKEUPREASON_NONE after any other reset.
+ */
+PMU_DPD_WAKEUPREASON_T Ckpt_GetWakeupReason(void);
+
+/**
+ * Restores the checkpoint data stored by #Ckpt_Save before the last Deep Power Down.
+ * @param pData : May not be @c NULL. Will be filled in, also when @c false is returned.
+ * @param size : The size of the data in bytes. Must match the size given to #Ckpt_Save, and be at most
+ *  #CKPT_MAX_SIZE.
+ * @return @c true when a valid checkpoint was found, @c false after a reset other than a wake-up from Deep Power Down,
+ *  or when the checkpoint is invalid.
+ * @pre The EEPROM driver is initialized, if @c size is larger than #CKPT_RETAINED_SIZE.
+ */
+bool Ckpt_Restore(void *pData, int size);
+
+/**
+ * Stores the checkpoint data, to be restored after the next wake-up from Deep Power Down.
+ * The first #CKPT_RETAINED_SIZE bytes go to the PMU retained data; the remainder, if any, is written to EEPROM when it
+ * differs from what is stored there already.
+ * @param pData : May not be @c NULL.
+ * @param size : The size of the data in bytes. Must be at most #CKPT_MAX_SIZE.
+ * @param activeTime : The time in microseconds the IC has been awake since the last wake-up, to be reported by
+ *  #Ckpt_GetActiveTime after the next wake-up. Kept with a resolution of 100 us, saturated to 6.5 seconds.
+ * @pre The EEPROM driver is initialized, if @c size is larger than #CKPT_RETAINED_SIZE.
+ * @post Enter Deep Power Down next: the retained data is lost on any other reset.
+ */
+void Ckpt_Save(const void *pData, int size, uint32_t activeTime);
+
+/**
+ * Retrieves the time the IC was awake before the last Deep Power Down, as given to #Ckpt_Save.
+ * @return The time in microseconds, or @c 0 when unknown.
+ * @pre #Ckpt_Restore returned @c true.
+ */
+uint32_t Ckpt_GetActiveTime(void);
+
+#endif /** @} */
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __CKPT_DFT_H_
+#define __CKPT_DFT_H_
+
+/** @defgroup MODS_LPC8Nxx_CKPT_DFT Diversity Settings
+ *  @ingroup MODS_LPC8Nxx_CKPT
+ * These 'defines' capture the diversity settings of the module. The displayed values refer to the default settings.
+ * To override the default settings, place the defines with their desired values in the application app_sel.h header
+ * file: the compiler will pick up your defines before parsing this file.
+ * @{
+ */
+
+/**
+ * The index of the first PMU retained data word used for the checkpoint.
+ */
+#if (!defined(CKPT_RETAINED_FIRST))
+    #define CKPT_RETAINED_FIRST 0
+#endif
+
+/**
+ * The number of PMU retained data words used for the checkpoint, starting at @ref CKPT_RETAINED_FIRST. One word holds
+ * the checkpoint header; the others hold the first bytes of the checkpoint data.
+ * @note The retained data section is shared by the whole application: leave the words used by other modules out of
+ *  this range.
+ */
+#if (!defined(CKPT_RETAINED_COUNT))
+    #define CKPT_RETAINED_COUNT 5
+#endif
+
+/**
+ * The offset, in bytes, in EEPROM where the checkpoint data that does not fit in the retained words is stored.
+ * By default, the third last writable EEPROM row is used.
+ */
+#if (!defined(CKPT_EEPROM_OFFSET))
+    #define CKPT_EEPROM_OFFSET ((EEPROM_NR_OF_RW_ROWS - 3) * EEPROM_ROW_SIZE)
+#endif
+
+/**
+ * The maximum number of bytes of checkpoint data that can be stored in EEPROM.
+ */
+#if (!defined(CKPT_EEPROM_SIZE))
+    #define CKPT_EEPROM_SIZE EEPROM_ROW_SIZE
+#endif
+
+/**
+ * @}
+ */
+
+#endif
@@ -0,0 +1,314 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include "gpioev.h"
+#include "timer.h"
+
+#if (GPIOEV_QUEUE_SIZE & (GPIOEV_QUEUE_SIZE - 1)) || (GPIOEV_QUEUE_SIZE > 128)
+    #error GPIOEV_QUEUE_SIZE must be a power of 2, and at most 128
+#endif
+
+/* -------------------------------------------------------------------------
+ * Private types and defines
+ * ------------------------------------------------------------------------- */
+
+/** The number of PIO0 pins. */
+#define PIN_COUNT 12
+
+/** The number of PIO0 pins that are a Start Logic source. */
+#define WAKE_PIN_COUNT 11
+
+/* -------------------------------------------------------------------------
+ * Private function prototypes
+ * ------------------------------------------------------------------------- */
+
+static void DebounceCb(uint32_t context);
+static void Push(const GPIOEV_EVENT_T *pEvent);
+static void Edges(uint32_t edges);
+static void WakeEdge(int pin);
+
+/* -------------------------------------------------------------------------
+ * Private variables
+ * ------------------------------------------------------------------------- */
+
+static TIMER_T sTimer;
+
+/** The monitored pins. */
+static uint32_t sEnabled;
+
+/** The last reported level of the monitored pins. */
+static uint32_t sStable;
+
+/** The pins with an edge since the last debounce. */
+static uint32_t sPending;
+
+/** The time stamp of the first edge of each pending pin. */
+static uint64_t sEdgeTime[PIN_COUNT];
+
+/** The Start Logic sources of the monitored pins. */
+static uint32_t sWake;
+
+/**
+ * The queue. sHead is only written by #Push, sTail only by #GpioEv_Get: both count on, and are reduced modulo the
+ * queue size on access.
+ */
+static GPIOEV_EVENT_T sQueue[GPIOEV_QUEUE_SIZE];
+static volatile uint8_t sHead;
+static volatile uint8_t sTail;
+
+static int sDropCount;
+
+/* -------------------------------------------------------------------------
+ * Private functions
+ * ------------------------------------------------------------------------- */
+
+/** Timer callback: the pending pins have been quiet for the debounce time. */
+static void DebounceCb(uint32_t context)
+{
+    GPIOEV_EVENT_T event;
+    uint32_t changed;
+    uint32_t levels;
+    uint32_t primask;
+    int pin;
+
+    (void)context;
+    primask = __get_PRIMASK();
+    __disable_irq();
+    levels = Chip_GPIO_GetPortValue(LPC_GPIO, 0);
+    changed = (levels ^ sStable) & sPending & sEnabled;
+    sStable ^= changed;
+    sPending = 0;
+    __set_PRIMASK(primask);
+
+    for (pin = 0; changed; pin++, changed >>= 1) {
+        if (changed & 1) {
+            event.timestamp = sEdgeTime[pin];
+            event.pin = (uint8_t)pin;
+            event.level = ((levels >> pin) & 1) != 0;
+            Push(&event);
+        }
+    }
+}
+
+/** Appends an event to the queue. Only called from #DebounceCb. */
+static void Push(const GPIOEV_EVENT_T *pEvent)
+{
+    uint8_t head = sHead;
+
+    if ((uint8_t)(head - sTail) >= GPIOEV_QUEUE_SIZE) {
+        sDropCount++;
+        return;
+    }
+    sQueue[head % GPIOEV_QUEUE_SIZE] = *pEvent;
+    __DMB(); /* The event is complete before it is published. */
+    sHead = (uint8_t)(head + 1);
+#ifdef GPIOEV_EVENT_CB
+    extern void GPIOEV_EVENT_CB(void);
+    GPIOEV_EVENT_CB();
+#endif
+}
+
+/** Time stamps the first edge of each pin, and (re)starts the debounce period. Called under interrupt. */
+static void Edges(uint32_t edges)
+{
+    uint32_t first;
+    uint64_t now;
+    int pin;
+
+    if (edges == 0) {
+        return;
+    }
+    first = edges & ~sPending;
+    if (first) {
+        now = Timer_GetTimestamp();
+        for (pin = 0; first; pin++, first >>= 1) {
+            if (first & 1) {
+                sEdgeTime[pin] = now;
+            }
+        }
+    }
+    sPending |= edges;
+    Timer_Start(&sTimer, GPIOEV_DEBOUNCE_TIME, DebounceCb, 0);
+}
+
+/**
+ * Handles the Start Logic interrupt of a pin. This is how an edge that ended Deep Sleep is seen: the GPIO block is not
+ * clocked in Deep Sleep, and its PIO0 interrupt may have missed it. While awake, the edges are seen twice: harmless.
+ */
+static void WakeEdge(int pin)
+{
+    Chip_SysCon_StartLogic_ClearStatus((SYSCON_STARTSOURCE_T)(1u << pin));
+    Edges((1u << pin) & sEnabled);
+}
+
+/* -------------------------------------------------------------------------
+ * Interrupt handlers
+ * ------------------------------------------------------------------------- */
+
+void PIO0_IRQHandler(void)
+{
+    uint32_t edges = Chip_GPIO_GetMaskedInts(LPC_GPIO, 0);
+
+    Chip_GPIO_ClearInts(LPC_GPIO, 0, edges);
+    Edges(edges);
+}
+
+void PIO0_0_IRQHandler(void)
+{
+    WakeEdge(0);
+}
+
+void PIO0_1_IRQHandler(void)
+{
+    WakeEdge(1);
+}
+
+void PIO0_2_IRQHandler(void)
+{
+    WakeEdge(2);
+}
+
+void PIO0_3_IRQHandler(void)
+{
+    WakeEdge(3);
+}
+
+void PIO0_4_IRQHandler(void)
+{
+    WakeEdge(4);
+}
+
+void PIO0_5_IRQHandler(void)
+{
+    WakeEdge(5);
+}
+
+void PIO0_6_IRQHandler(void)
+{
+    WakeEdge(6);
+}
+
+void PIO0_7_IRQHandler(void)
+{
+    WakeEdge(7);
+}
+
+void PIO0_8_IRQHandler(void)
+{
+    WakeEdge(8);
+}
+
+void PIO0_9_IRQHandler(void)
+{
+    WakeEdge(9);
+}
+
+void PIO0_10_IRQHandler(void)
+{
+    WakeEdge(10);
+}
+
+/* -------------------------------------------------------------------------
+ * Exported functions
+ * ------------------------------------------------------------------------- */
+
+void GpioEv_Init(void)
+{
+    Timer_Stop(&sTimer);
+    Chip_GPIO_DisableInt(LPC_GPIO, 0, sEnabled);
+    sEnabled = 0;
+    sPending = 0;
+    sWake = 0;
+    sHead = 0;
+    sTail = 0;
+    sDropCount = 0;
+    NVIC_EnableIRQ(PIO0_IRQn);
+}
+
+void GpioEv_Enable(int pin, GPIOEV_WAKE_T wake)
+{
+    uint32_t mask;
+    uint32_t primask;
+
+    ASSERT((pin >= 0) && (pin < PIN_COUNT) && ((wake == GPIOEV_WAKE_NONE) || (pin < WAKE_PIN_COUNT)));
+    mask = 1u << pin;
+    primask = __get_PRIMASK();
+    __disable_irq();
+    Chip_GPIO_SetPinDIRInput(LPC_GPIO, 0, (uint8_t)pin);
+    Chip_GPIO_SetupPinInt(LPC_GPIO, 0, (uint8_t)pin, GPIO_INT_BOTH_EDGES);
+    Chip_GPIO_ClearInts(LPC_GPIO, 0, mask);
+    sStable = (sStable & ~mask) | (Chip_GPIO_GetPortValue(LPC_GPIO, 0) & mask);
+    sPending &= ~mask;
+    sEnabled |= mask;
+    Chip_GPIO_EnableInt(LPC_GPIO, 0, mask);
+
+    sWake &= ~mask;
+    if (wake != GPIOEV_WAKE_NONE) {
+        sWake |= mask;
+        if (wake == GPIOEV_WAKE_RISING) {
+            Chip_SysCon_StartLogic_SetPIORisingEdge((SYSCON_STARTSOURCE_T)(Chip_SysCon_StartLogic_GetPIORisingEdge()
+                    | mask));
+        }
+        else {
+            Chip_SysCon_StartLogic_SetPIORisingEdge((SYSCON_STARTSOURCE_T)(Chip_SysCon_StartLogic_GetPIORisingEdge()
+                    & ~mask));
+        }
+    }
+    __set_PRIMASK(primask);
+}
+
+void GpioEv_Disable(int pin)
+{
+    uint32_t mask;
+    uint32_t primask;
+
+    ASSERT((pin >= 0) && (pin < PIN_COUNT));
+    mask = 1u << pin;
+    primask = __get_PRIMASK();
+    __disable_irq();
+    Chip_GPIO_DisableInt(LPC_GPIO, 0, mask);
+    Chip_GPIO_ClearInts(LPC_GPIO, 0, mask);
+    sEnabled &= ~mask;
+    sPending &= ~mask;
+    sWake &= ~mask;
+    __set_PRIMASK(primask);
+}
+
+SYSCON_STARTSOURCE_T GpioEv_GetWakeSources(void)
+{
+    /* The Start Logic source bits equal the pin numbers. */
+    return (SYSCON_STARTSOURCE_T)sWake;
+}
+
+bool GpioEv_Get(GPIOEV_EVENT_T *pEvent)
+{
+    uint8_t tail = sTail;
+
+    ASSERT(pEvent != NULL);
+    if (tail == sHead) {
+        return false;
+    }
+    __DMB(); /* Read the event only after seeing it published. */
+    *pEvent = sQueue[tail % GPIOEV_QUEUE_SIZE];
+    __DMB(); /* The slot is read before it is released. */
+    sTail = (uint8_t)(tail + 1);
+    return true;
+}
+
+int GpioEv_GetDropCount(void)
+{
+    return sDropCount;
+}
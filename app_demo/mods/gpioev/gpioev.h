@@ -0,0 +1,119 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __GPIOEV_H_
+#define __GPIOEV_H_
+
+/** @defgroup MODS_LPC8Nxx_GPIOEV gpioev: GPIO event module
+ * @ingroup MODS_LPC8Nxx
+ * The GPIO event module turns edges on PIO0 pins - from push buttons, reed switches and the like - into debounced
+ * events, queued for the main thread.
+ *
+ * The PIO0 interrupt handler only time stamps the first edge on a pin and (re)starts a software timer: there is no
+ * busy wait. Once the monitored pins have been quiet for #GPIOEV_DEBOUNCE_TIME, the timer callback samples them, and
+ * queues an event for each pin whose level differs from its last reported level. A bouncing contact thus costs a few
+ * microseconds per edge, and a single event.
+ *
+ * The queue is lock-free: it is filled by the timer callback and emptied by the main thread, without disabling
+ * interrupts.
+ *
+ * @par Diversity
+ *  This module supports diversity, like the debounce time and a callback when an event is queued.
+ *  Check @ref MODS_LPC8Nxx_GPIOEV_DFT for all diversity parameters.
+ *
+ * @par Usage
+ *  - Configure the pins as digital GPIO with #Chip_IOCON_SetPinConfig, with a pull-up or pull-down as needed.
+ *  - Call #Timer_Init, then #GpioEv_Init.
+ *  - Call #GpioEv_Enable for each pin to monitor.
+ *  - To let edges end Deep Sleep, pass #GpioEv_GetWakeSources to #Power_SetWakeSources.
+ *  - Retrieve the events with #GpioEv_Get, e.g. from an event handler posted by @ref GPIOEV_EVENT_CB.
+ *  .
+ *
+ * @note This mod provides an implementation of the interrupt vector #PIO0_IRQHandler and enables the interrupt
+ *  #PIO0_IRQn. It also provides the Start Logic interrupt vectors #PIO0_0_IRQHandler up to #PIO0_10_IRQHandler, which
+ *  #Power_SetWakeSources enables: they pick up the edge that ended Deep Sleep.
+ * @note While debouncing, a timer runs on the 32-bit timer: the IC does not enter Deep Sleep then, see
+ *  #Timer_IsFastRunning.
+ *
+ * @{
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include "chip.h"
+#include "app_sel.h"
+#include "gpioev_dft.h"
+
+/* -------------------------------------------------------------------------
+ * Types and defines
+ * ------------------------------------------------------------------------- */
+
+/** Selects the Start Logic edge of a pin, to end Deep Sleep. */
+typedef enum GPIOEV_WAKE {
+    GPIOEV_WAKE_NONE, /**< The pin does not end Deep Sleep. */
+    GPIOEV_WAKE_FALLING, /**< A falling edge ends Deep Sleep, e.g. for an active low button. */
+    GPIOEV_WAKE_RISING /**< A rising edge ends Deep Sleep. */
+} GPIOEV_WAKE_T;
+
+/** A debounced level change of a pin. */
+typedef struct GPIOEV_EVENT_S {
+    uint64_t timestamp; /**< The value of #Timer_GetTimestamp at the first edge. */
+    uint8_t pin; /**< The PIO0 pin. */
+    bool level; /**< The new, stable level of the pin. */
+} GPIOEV_EVENT_T;
+
+/* -------------------------------------------------------------------------
+ * Exported function prototypes
+ * ------------------------------------------------------------------------- */
+
+/**
+ * Initializes the module: no pins are monitored, and the queue is empty.
+ * @pre #Timer_Init has been called.
+ */
+void GpioEv_Init(void);
+
+/**
+ * Starts monitoring a pin. The pin is made an input, interrupting on both edges. Its current level is taken as
+ * stable: no event is queued for it.
+ * @param pin : The PIO0 pin, in the range [0, 11].
+ * @param wake : Whether, and on which edge, the pin is a Start Logic source. Only pins 0 to 10 can be.
+ */
+void GpioEv_Enable(int pin, GPIOEV_WAKE_T wake);
+
+/**
+ * Stops monitoring a pin. A pending debounce of the pin is dropped.
+ * @param pin : The PIO0 pin, in the range [0, 11].
+ */
+void GpioEv_Disable(int pin);
+
+/**
+ * @return The Start Logic sources of the monitored pins enabled with a wake edge: to be passed on to
+ *  #Power_SetWakeSources, together with the application's other sources.
+ */
+SYSCON_STARTSOURCE_T GpioEv_GetWakeSources(void);
+
+/**
+ * Retrieves the oldest queued event.
+ * @param pEvent : May not be @c NULL. Filled in when an event is returned.
+ * @return @c true when an event is returned, @c false when the queue is empty.
+ * @note Must be called from a single thread of execution only, typically the main thread.
+ */
+bool GpioEv_Get(GPIOEV_EVENT_T *pEvent);
+
+/**
+ * @return The number of events dropped because the queue was full, since #GpioEv_Init.
+ */
+int GpioEv_GetDropCount(void);
+
+#endif /** @} */
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __GPIOEV_DFT_H_
+#define __GPIOEV_DFT_H_
+
+/** @defgroup MODS_LPC8Nxx_GPIOEV_DFT Diversity Settings
+ *  @ingroup MODS_LPC8Nxx_GPIOEV
+ * These 'defines' capture the diversity settings of the module. The displayed values refer to the default settings.
+ * To override the default settings, place the defines with their desired values in the application app_sel.h header
+ * file: the compiler will pick up your defines before parsing this file.
+ * @{
+ */
+
+/**
+ * The time in milliseconds the monitored pins must be quiet before their levels are taken as stable.
+ * Each edge on a monitored pin restarts this period. Push buttons and reed switches typically bounce for less than
+ * 10 ms.
+ */
+#if (!defined(GPIOEV_DEBOUNCE_TIME))
+    #define GPIOEV_DEBOUNCE_TIME 20
+#endif
+
+/**
+ * The number of events the queue can hold. When the queue is full, new events are dropped.
+ * @note Must be a power of 2, and at most 128.
+ */
+#if (!defined(GPIOEV_QUEUE_SIZE))
+    #define GPIOEV_QUEUE_SIZE 8
+#endif
+
+/**
+ * By default, nothing is notified when an event is queued: the application must poll #GpioEv_Get.
+ * Set this define to the function to be called each time an event is queued - e.g. to post an event to the main
+ * loop.
+ * @note The function must have the signature: @code void GPIOEV_EVENT_CB(void) @endcode
+ * @note It is called under interrupt.
+ * @note This must be set to the name of a function, not a pointer to a function: no dereference will be made!
+ */
+#ifndef GPIOEV_EVENT_CB
+//    #define GPIOEV_EVENT_CB your_callback
+#endif
+
+/**
+ * @}
+ */
+
+#endif
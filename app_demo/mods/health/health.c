@@ -0,0 +1,242 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include "health.h"
+#include "timer.h"
+
+/* -------------------------------------------------------------------------
+ * Private types and defines
+ * ------------------------------------------------------------------------- */
+
+/** Marks a culprit record in the retained data word. The task ID is kept in the lower half word. */
+#define RECORD_MAGIC 0xDEAD0000
+
+/** The longest timeout the watchdog can count: in ticks of 4 watchdog clock cycles. */
+#define MAX_TIMEOUT 0x00FFFFFF
+
+typedef struct HEALTH_TASK_S {
+    uint64_t checkIn; /**< The value of #Timer_GetTimestamp at the last check-in. */
+    uint32_t deadline; /**< In microseconds. */
+    bool active; /**< @c false while paused. */
+} HEALTH_TASK_T;
+
+/* -------------------------------------------------------------------------
+ * Private function prototypes
+ * ------------------------------------------------------------------------- */
+
+static int FindOverdue(uint64_t now, uint64_t *pExpiry);
+static void Arm(void);
+static void DeadlineCb(uint32_t context);
+
+/* -------------------------------------------------------------------------
+ * Private variables
+ * ------------------------------------------------------------------------- */
+
+static HEALTH_TASK_T sTasks[HEALTH_MAX_TASKS];
+
+static int sTaskCount;
+
+/** The longest deadline of the registered tasks, in milliseconds. */
+static uint32_t sLongest;
+
+/** Set when a task missed its deadline: the watchdog is no longer fed. */
+static bool sStalled;
+
+static int sCulprit = HEALTH_NO_TASK;
+
+static TIMER_T sTimer;
+
+/* -------------------------------------------------------------------------
+ * Private functions
+ * ------------------------------------------------------------------------- */
+
+/**
+ * Looks for a task that missed its deadline.
+ * @param now : The current time stamp.
+ * @param pExpiry : Receives the earliest end of the deadlines of the active tasks, or 0 if there are none.
+ * @return The ID of an overdue task, or #HEALTH_NO_TASK.
+ * @pre Interrupts are disabled.
+ */
+static int FindOverdue(uint64_t now, uint64_t *pExpiry)
+{
+    uint64_t expiry;
+    int id;
+
+    *pExpiry = 0;
+    for (id = 0; id < sTaskCount; id++) {
+        if (sTasks[id].active) {
+            expiry = sTasks[id].checkIn + sTasks[id].deadline;
+            if (now > expiry) {
+                return id;
+            }
+            if ((*pExpiry == 0) || (expiry < *pExpiry)) {
+                *pExpiry = expiry;
+            }
+        }
+    }
+    return HEALTH_NO_TASK;
+}
+
+/**
+ * Starts the timer for the earliest deadline. When no task is active, the timer feeds the watchdog instead.
+ * @pre Interrupts are disabled.
+ */
+static void Arm(void)
+{
+    uint64_t now = Timer_GetTimestamp();
+    uint64_t expiry;
+
+    if (FindOverdue(now, &expiry) != HEALTH_NO_TASK) {
+        Timer_Start(&sTimer, 1, DeadlineCb, 0);
+    }
+    else if (expiry == 0) {
+        Timer_Start(&sTimer, sLongest, DeadlineCb, 0);
+    }
+    else {
+        /* Rounded up: the timer never fires before the deadline is over. */
+        Timer_Start(&sTimer, (uint32_t)((expiry - now) / 1000) + 1, DeadlineCb, 0);
+    }
+}
+
+/** Timer callback: the earliest deadline is over, unless its task checked in meanwhile. */
+static void DeadlineCb(uint32_t context)
+{
+    uint64_t expiry;
+    uint32_t primask;
+    int id;
+#if HEALTH_RETAINED_WORD >= 0
+    uint32_t record;
+#endif
+
+    (void)context;
+    primask = __get_PRIMASK();
+    __disable_irq();
+    id = FindOverdue(Timer_GetTimestamp(), &expiry);
+    if (id == HEALTH_NO_TASK) {
+        if ((expiry == 0) && !sStalled) {
+            /* All tasks are paused: nobody checks in. */
+            Chip_WWDT_Feed(LPC_WWDT);
+        }
+        Arm();
+    }
+    else if (!sStalled) {
+        /* Let the watchdog expire. */
+        sStalled = true;
+#if HEALTH_RETAINED_WORD >= 0
+        record = RECORD_MAGIC | (uint32_t)id;
+        Chip_PMU_SetRetainedData(&record, HEALTH_RETAINED_WORD, 1);
+#endif
+    }
+    __set_PRIMASK(primask);
+}
+
+/* -------------------------------------------------------------------------
+ * Exported functions
+ * ------------------------------------------------------------------------- */
+
+void Health_Init(void)
+{
+#if HEALTH_RETAINED_WORD >= 0
+    uint32_t record;
+
+    Chip_PMU_GetRetainedData(&record, HEALTH_RETAINED_WORD, 1);
+    if ((record & 0xFFFF0000) == RECORD_MAGIC) {
+        sCulprit = (int)(record & 0xFFFF);
+        record = 0;
+        Chip_PMU_SetRetainedData(&record, HEALTH_RETAINED_WORD, 1);
+    }
+#endif
+    Timer_Stop(&sTimer);
+    sTaskCount = 0;
+    sLongest = 0;
+    sStalled = false;
+
+    Chip_Clock_Watchdog_SetClockSource(CLOCK_WATCHDOGSOURCE_SFRO);
+    Chip_Clock_Watchdog_SetClockFreq(1); /* Rounded up to the smallest frequency: the longest timeout. */
+    Chip_WWDT_Init(LPC_WWDT);
+}
+
+int Health_Register(uint32_t deadline)
+{
+    uint64_t timeout;
+    uint32_t primask;
+    int id;
+
+    ASSERT((deadline >= 1) && (deadline <= 1000000) && (sTaskCount < HEALTH_MAX_TASKS));
+    primask = __get_PRIMASK();
+    __disable_irq();
+    id = sTaskCount++;
+    sTasks[id].checkIn = Timer_GetTimestamp();
+    sTasks[id].deadline = deadline * 1000;
+    sTasks[id].active = true;
+    if (deadline > sLongest) {
+        sLongest = deadline;
+        timeout = ((uint64_t)(sLongest + HEALTH_MARGIN) * Chip_Clock_Watchdog_GetClockFreq()) / 4000;
+        ASSERT(timeout <= MAX_TIMEOUT);
+        /* Takes effect on the next feed. */
+        Chip_WWDT_SetTimeOut(LPC_WWDT, (uint32_t)timeout);
+        if (id == 0) {
+            Chip_WWDT_SetOption(LPC_WWDT, WWDT_WDMOD_WDRESET);
+            Chip_WWDT_Start(LPC_WWDT);
+        }
+        else if (!sStalled) {
+            Chip_WWDT_Feed(LPC_WWDT);
+        }
+    }
+    Arm();
+    __set_PRIMASK(primask);
+    return id;
+}
+
+void Health_CheckIn(int id)
+{
+    uint64_t expiry;
+    uint64_t now;
+    uint32_t primask;
+
+    ASSERT((id >= 0) && (id < sTaskCount));
+    primask = __get_PRIMASK();
+    __disable_irq();
+    now = Timer_GetTimestamp();
+    if (!sStalled) {
+        sTasks[id].checkIn = now;
+        sTasks[id].active = true;
+        if (FindOverdue(now, &expiry) == HEALTH_NO_TASK) {
+            Chip_WWDT_Feed(LPC_WWDT);
+        }
+        Arm();
+    }
+    __set_PRIMASK(primask);
+}
+
+void Health_Pause(int id)
+{
+    uint32_t primask;
+
+    ASSERT((id >= 0) && (id < sTaskCount));
+    primask = __get_PRIMASK();
+    __disable_irq();
+    sTasks[id].active = false;
+    if (!sStalled) {
+        Arm();
+    }
+    __set_PRIMASK(primask);
+}
+
+int Health_GetCulprit(void)
+{
+    return sCulprit;
+}
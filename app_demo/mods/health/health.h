@@ -0,0 +1,101 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __HEALTH_H_
+#define __HEALTH_H_
+
+/** @defgroup MODS_LPC8Nxx_HEALTH health: Task health monitor module
+ * @ingroup MODS_LPC8Nxx
+ * The health monitor supervises long-lived tasks - e.g. a logger, an NFC publisher, the measurement cycle - with the
+ * watchdog. Each task registers with a deadline, and checks in each time it has made progress. The watchdog is fed
+ * on a check-in only when every task has checked in within its deadline: a task that stalls - e.g. in an endless
+ * EEPROM flush wait or a conversion that never completes - stops the feeding, and the watchdog resets the IC.
+ *
+ * There is no periodic polling. A single software timer is armed for the earliest deadline, and re-armed on each
+ * check-in. When it expires, a task is overdue: it is recorded as the culprit, in a PMU retained data word that
+ * survives the coming watchdog reset - see @ref HEALTH_RETAINED_WORD - and the feeding stops. A stall that keeps the
+ * timer interrupt from running is caught by the watchdog alone, without a record.
+ *
+ * @par Diversity
+ *  This module supports diversity, like the number of tasks and the retained data word used for the record.
+ *  Check @ref MODS_LPC8Nxx_HEALTH_DFT for all diversity parameters.
+ *
+ * @par Usage
+ *  - Call #Timer_Init, then #Health_Init. Check #Health_GetCulprit for a watchdog reset caused by a stalled task.
+ *  - Call #Health_Register once for each task, and #Health_CheckIn whenever the task has made progress.
+ *  - Call #Health_Pause when a task is idle on purpose: its deadline is suspended until its next check-in.
+ *  .
+ *
+ * @note Once started, the watchdog cannot be stopped, other than by a reset: Deep Power Down stops it. Deadlines
+ *  must include the time spent in Sleep and Deep Sleep.
+ * @note The watchdog of this IC has no window: a check-in is never too early.
+ *
+ * @{
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include "chip.h"
+#include "app_sel.h"
+#include "health_dft.h"
+
+/* -------------------------------------------------------------------------
+ * Types and defines
+ * ------------------------------------------------------------------------- */
+
+/** Value returned by #Health_GetCulprit when no task is to blame. */
+#define HEALTH_NO_TASK (-1)
+
+/* -------------------------------------------------------------------------
+ * Exported function prototypes
+ * ------------------------------------------------------------------------- */
+
+/**
+ * Initializes the module: no tasks are registered, and the culprit of the last reset - if any - is retrieved. The
+ * watchdog clock is set to its smallest frequency: the longest timeout. The watchdog is started by the first call to
+ * #Health_Register.
+ * @pre #Timer_Init has been called.
+ */
+void Health_Init(void);
+
+/**
+ * Registers a task. Its deadline runs from now on, and the watchdog timeout is extended when needed.
+ * @param deadline : The longest allowed time between two check-ins of the task, in milliseconds. At least 1 and at
+ *  most 1000000.
+ * @return The task ID to use in #Health_CheckIn and #Health_Pause.
+ */
+int Health_Register(uint32_t deadline);
+
+/**
+ * Marks the progress of a task. Its deadline starts over, and the watchdog is fed when no task is overdue.
+ * @param id : The ID as returned by #Health_Register.
+ * @note May be called under interrupt.
+ */
+void Health_CheckIn(int id);
+
+/**
+ * Suspends the deadline of a task, until its next call to #Health_CheckIn. While all tasks are paused, the watchdog
+ * is fed by the timer.
+ * @param id : The ID as returned by #Health_Register.
+ * @note May be called under interrupt.
+ */
+void Health_Pause(int id);
+
+/**
+ * @return The ID of the task that missed its deadline before the last reset, or #HEALTH_NO_TASK.
+ * @note Always #HEALTH_NO_TASK when @ref HEALTH_RETAINED_WORD is @c -1.
+ */
+int Health_GetCulprit(void);
+
+#endif /** @} */
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __HEALTH_DFT_H_
+#define __HEALTH_DFT_H_
+
+/** @defgroup MODS_LPC8Nxx_HEALTH_DFT Diversity Settings
+ *  @ingroup MODS_LPC8Nxx_HEALTH
+ * These 'defines' capture the diversity settings of the module. The displayed values refer to the default settings.
+ * To override the default settings, place the defines with their desired values in the application app_sel.h header
+ * file: the compiler will pick up your defines before parsing this file.
+ * @{
+ */
+
+/**
+ * The maximum number of tasks that can be registered with #Health_Register.
+ */
+#if (!defined(HEALTH_MAX_TASKS))
+    #define HEALTH_MAX_TASKS 4
+#endif
+
+/**
+ * The time in milliseconds the watchdog timeout exceeds the longest deadline of the registered tasks.
+ * The watchdog is only fed on a check-in: its timeout must cover the longest time between two check-ins of healthy
+ * tasks, which is at most the longest deadline.
+ */
+#if (!defined(HEALTH_MARGIN))
+    #define HEALTH_MARGIN 2000
+#endif
+
+/**
+ * The index of the PMU retained data word used to record the task that missed its deadline, or @c -1 to not record
+ * it. The record survives the watchdog reset, and is retrieved with #Health_GetCulprit.
+ * @note The retained data section is shared by the whole application: make sure no other module uses this word. See
+ *  also @ref CKPT_RETAINED_COUNT.
+ */
+#if (!defined(HEALTH_RETAINED_WORD))
+    #define HEALTH_RETAINED_WORD (-1)
+#endif
+
+/**
+ * @}
+ */
+
+#endif
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include "i2cm.h"
+
+/* -------------------------------------------------------------------------
+ * Private function prototypes
+ * ------------------------------------------------------------------------- */
+
+static void Activity(bool active);
+static void EventHandler(I2C_ID_T id, I2C_EVENT_T event);
+
+/* -------------------------------------------------------------------------
+ * Private variables
+ * ------------------------------------------------------------------------- */
+
+/** The job in progress, followed by the queued jobs. @c NULL when idle. */
+static I2CM_JOB_T * volatile sHead = NULL;
+
+/** The last queued job. Only valid when sHead is not @c NULL. */
+static I2CM_JOB_T *sTail;
+
+/* -------------------------------------------------------------------------
+ * Private functions
+ * ------------------------------------------------------------------------- */
+
+static void Activity(bool active)
+{
+#if defined(I2CM_ACTIVITY_CB)
+    extern void I2CM_ACTIVITY_CB(bool active);
+    I2CM_ACTIVITY_CB(active);
+#else
+    (void)active;
+#endif
+}
+
+/**
+ * Called by #Chip_I2C_MasterStateHandler under interrupt, once per job: the repeated START conditions within a job are
+ * handled by the driver. Starts the next job before reporting the completed one: its START condition follows the STOP
+ * condition on the bus without waiting for the callback.
+ */
+static void EventHandler(I2C_ID_T id, I2C_EVENT_T event)
+{
+    I2CM_JOB_T *pJob = sHead;
+
+    if ((event != I2C_EVENT_DONE) || (pJob == NULL)) {
+        return;
+    }
+
+    sHead = pJob->pNext;
+    pJob->pNext = NULL;
+    if (sHead != NULL) {
+        Chip_I2C_MasterStartSeq(id, sHead->pXfers, sHead->count);
+    }
+    else {
+        Chip_I2C_MasterEndXfer(id);
+        Activity(false);
+    }
+
+    if (pJob->cb != NULL) {
+        pJob->cb(pJob);
+    }
+}
+
+/* -------------------------------------------------------------------------
+ * Exported functions
+ * ------------------------------------------------------------------------- */
+
+void I2C0_IRQHandler(void)
+{
+    if (Chip_I2C_IsMasterActive(I2C0)) {
+        Chip_I2C_MasterStateHandler(I2C0);
+    }
+    else {
+        Chip_I2C_SlaveStateHandler(I2C0);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+void I2cm_Init(void)
+{
+    sHead = NULL;
+    Chip_I2C_SetMasterEventHandler(I2C0, EventHandler);
+    NVIC_EnableIRQ(I2C0_IRQn);
+}
+
+void I2cm_Submit(I2CM_JOB_T *pJob)
+{
+    uint32_t primask;
+    int i;
+
+    ASSERT((pJob != NULL) && (pJob->pXfers != NULL) && (pJob->count > 0));
+    pJob->pNext = NULL;
+    for (i = 0; i < pJob->count; i++) {
+        pJob->pXfers[i].status = I2C_STATUS_BUSY;
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (sHead == NULL) {
+        sHead = pJob;
+        sTail = pJob;
+        Activity(true);
+        Chip_I2C_MasterStartSeq(I2C0, pJob->pXfers, pJob->count);
+    }
+    else {
+        ASSERT((pJob != sHead) && (pJob != sTail));
+        sTail->pNext = pJob;
+        sTail = pJob;
+    }
+    __set_PRIMASK(primask);
+}
+
+I2C_STATUS_T I2cm_GetStatus(const I2CM_JOB_T *pJob)
+{
+    int i;
+
+    ASSERT(pJob != NULL);
+    for (i = 0; i < pJob->count; i++) {
+        if (pJob->pXfers[i].status != I2C_STATUS_DONE) {
+            /* Either the failing transfer, or the first one not yet done. */
+            return pJob->pXfers[i].status;
+        }
+    }
+    return I2C_STATUS_DONE;
+}
+
+bool I2cm_IsIdle(void)
+{
+    return sHead == NULL;
+}
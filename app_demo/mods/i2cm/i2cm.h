@@ -0,0 +1,131 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __I2CM_H_
+#define __I2CM_H_
+
+/** @defgroup MODS_LPC8Nxx_I2CM i2cm: Asynchronous I2C master module
+ * @ingroup MODS_LPC8Nxx
+ * The asynchronous I2C master module queues I2C master jobs and executes them under interrupt, one after the other.
+ * Each job reports its completion through its own callback.
+ *
+ * A job is a sequence of one or more I2C master transfers, chained with repeated START conditions and ended with a
+ * single STOP condition. E.g. reading several registers of a sensor takes one job of write-then-read transfers,
+ * instead of one full START to STOP transfer per register: the bus is occupied shorter, and the IC wakes up once.
+ *
+ * The blocking driver API (#Chip_I2C_MasterTransfer and friends) keeps the CPU busy - or at best sleeping with a
+ * return to the caller - for the whole transfer, and needs a round trip through the caller for each next transfer.
+ * Here, the interrupt handler starts the next queued job right after the STOP condition of the previous one: a series
+ * of sensor or EEPROM accesses runs to completion while the main thread sleeps.
+ *
+ * @par Diversity
+ *  This module supports diversity, like a callback to keep the IC out of Deep Sleep while jobs are queued.
+ *  Check @ref MODS_LPC8Nxx_I2CM_DFT for all diversity parameters.
+ *
+ * @par Usage
+ *  - Initialize the I2C driver with #Chip_I2C_Init, set the bit rate and configure the pins.
+ *  - Call #I2cm_Init.
+ *  - Fill in an #I2CM_JOB_T and call #I2cm_Submit. The job is owned by this module until its callback is called.
+ *  - Check the outcome with #I2cm_GetStatus.
+ *  .
+ *
+ * @par Example
+ *  Reading two registers of a sensor in one job:
+ *  @code
+ *  static const uint8_t sReg[2] = {REG_TEMPERATURE, REG_HUMIDITY};
+ *  static uint8_t sData[4];
+ *  static I2C_XFER_T sXfers[2] = {
+ *      {SENSOR_ADDR, &sReg[0], 1, &sData[0], 2, I2C_STATUS_DONE},
+ *      {SENSOR_ADDR, &sReg[1], 1, &sData[2], 2, I2C_STATUS_DONE}
+ *  };
+ *  static I2CM_JOB_T sJob = {.pXfers = sXfers, .count = 2, .cb = SensorCb};
+ *  I2cm_Submit(&sJob);
+ *  @endcode
+ *  The buffers and sizes are consumed by the transfers: fill them in again before submitting the job again.
+ *
+ * @note This mod provides an implementation of the interrupt vector #I2C0_IRQHandler and enables the interrupt
+ *  #I2C0_IRQn. Slave transfers set up with #Chip_I2C_SlaveSetup are still served by it.
+ * @note The I2C clock is derived from the System Clock, which is stopped in Deep Sleep: a transfer does not proceed
+ *  in Deep Sleep. See @ref I2CM_ACTIVITY_CB.
+ * @note Do not use the blocking master API of the I2C driver after #I2cm_Init.
+ *
+ * @{
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include "chip.h"
+#include "app_sel.h"
+#include "i2cm_dft.h"
+
+/* -------------------------------------------------------------------------
+ * Types and defines
+ * ------------------------------------------------------------------------- */
+
+typedef struct I2CM_JOB_S I2CM_JOB_T;
+
+/**
+ * Callback function type to report the completion of a job.
+ * @param pJob : The job as given to #I2cm_Submit. See #I2cm_GetStatus for the outcome. The sizes of each transfer hold
+ *  the number of bytes not transferred.
+ * @note Called under interrupt. The next job - if any - is already started. The job may be submitted again from
+ *  within the callback.
+ */
+typedef void (*pI2cm_Cb_t)(I2CM_JOB_T *pJob);
+
+/** A sequence of I2C master transfers, queued by #I2cm_Submit. */
+struct I2CM_JOB_S {
+    I2CM_JOB_T *pNext; /**< Private: do not use. */
+    I2C_XFER_T *pXfers; /**< The transfers, see #Chip_I2C_MasterTransfer. Must remain valid until completion. */
+    int count; /**< The number of transfers in @c pXfers. At least 1. */
+    pI2cm_Cb_t cb; /**< Called on completion. May be @c NULL: poll #I2cm_GetStatus instead. */
+    uint32_t context; /**< Not used by this mod: free for the caller's own housekeeping. */
+};
+
+/* -------------------------------------------------------------------------
+ * Exported function prototypes
+ * ------------------------------------------------------------------------- */
+
+/**
+ * Initializes the module: installs its master event handler and enables the I2C interrupt.
+ * @pre #Chip_I2C_Init has been called, and the bit rate has been set.
+ */
+void I2cm_Init(void);
+
+/**
+ * Appends a job to the queue. If the queue was empty, the job starts immediately.
+ * @param pJob : May not be @c NULL, and may not be queued already. The status of all its transfers is set to
+ *  #I2C_STATUS_BUSY.
+ * @note This function may be called from both main and interrupt context.
+ */
+void I2cm_Submit(I2CM_JOB_T *pJob);
+
+/**
+ * Retrieves the outcome of a job. The job ends at the first transfer that fails:
+ * - #I2C_STATUS_NAK or #I2C_STATUS_BUSERR: a STOP condition was sent. The transfers up to the failing one are done.
+ * - #I2C_STATUS_ARBLOST: another master took the bus halfway, and no STOP condition was sent. A sequence is only
+ *  consistent when executed as a whole: fill in the buffers and sizes again, and submit the job again.
+ * .
+ * @param pJob : May not be @c NULL.
+ * @return #I2C_STATUS_BUSY while the job is queued or in progress, else #I2C_STATUS_DONE or the status of the failing
+ *  transfer.
+ */
+I2C_STATUS_T I2cm_GetStatus(const I2CM_JOB_T *pJob);
+
+/**
+ * @return @c true when no job is queued or in progress.
+ */
+bool I2cm_IsIdle(void);
+
+#endif /** @} */
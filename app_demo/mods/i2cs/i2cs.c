@@ -0,0 +1,136 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include "i2cs.h"
+
+/* -------------------------------------------------------------------------
+ * Private types and defines
+ * ------------------------------------------------------------------------- */
+
+/** Keeps the acknowledge bit set on every received byte: see #Chip_I2C_SlaveSetup. */
+#define RX_SIZE 0x7FFF
+
+/* -------------------------------------------------------------------------
+ * Private function prototypes
+ * ------------------------------------------------------------------------- */
+
+static void SetAddress(int address);
+static void EventHandler(I2C_ID_T id, I2C_EVENT_T event);
+
+/* -------------------------------------------------------------------------
+ * Private variables
+ * ------------------------------------------------------------------------- */
+
+/** The register space. */
+static const volatile uint8_t *sRegisters;
+static int sSize;
+
+/**
+ * The slave transfer of the driver. Its tx pointer is the register address, pointing straight into the register
+ * space. Received bytes all land in sReceived.
+ */
+static I2C_XFER_T sXfer;
+
+static uint8_t sReceived;
+
+/** Sent for addresses outside the register space. */
+static const uint8_t sFiller = 0xFF;
+
+/** @c true until the first byte of a write transfer - the register address - has been received. */
+static bool sExpectAddress = true;
+
+/* -------------------------------------------------------------------------
+ * Private functions
+ * ------------------------------------------------------------------------- */
+
+static void SetAddress(int address)
+{
+    if ((address >= 0) && (address < sSize)) {
+        sXfer.txBuff = (const uint8_t *)sRegisters + address;
+        sXfer.txSz = sSize - address;
+    }
+    else {
+        sXfer.txBuff = &sFiller;
+        sXfer.txSz = 1;
+    }
+}
+
+/** Called by #Chip_I2C_SlaveStateHandler under interrupt. */
+static void EventHandler(I2C_ID_T id, I2C_EVENT_T event)
+{
+    (void)id;
+    switch (event) {
+        case I2C_EVENT_SLAVE_RX:
+            if (sExpectAddress) {
+                sExpectAddress = false;
+                SetAddress(sReceived);
+            }
+            else {
+#if defined(I2CS_WRITE_CB)
+                extern void I2CS_WRITE_CB(int address, uint8_t value);
+                I2CS_WRITE_CB((sXfer.txBuff == &sFiller) ? I2CS_MAX_SIZE : sXfer.txBuff - sRegisters, sReceived);
+#endif
+                if (sXfer.txSz > 1) {
+                    sXfer.txBuff++;
+                    sXfer.txSz--;
+                }
+                else if (sXfer.txBuff != &sFiller) {
+                    SetAddress(0);
+                }
+            }
+            sXfer.rxBuff = &sReceived;
+            sXfer.rxSz = RX_SIZE;
+            break;
+
+        case I2C_EVENT_DONE:
+            /* STOP or repeated START condition: a next write starts with a register address. */
+            sExpectAddress = true;
+            if (sXfer.txSz <= 0) {
+                SetAddress(0);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+/* -------------------------------------------------------------------------
+ * Exported functions
+ * ------------------------------------------------------------------------- */
+
+#if I2CS_IRQHANDLER
+void I2C0_IRQHandler(void)
+{
+    Chip_I2C_SlaveStateHandler(I2C0);
+}
+#endif
+
+/* ------------------------------------------------------------------------- */
+
+void I2cs_Init(uint8_t slaveAddr, const volatile void *pRegisters, int size)
+{
+    ASSERT((pRegisters != NULL) && (size > 0) && (size <= I2CS_MAX_SIZE));
+    sRegisters = pRegisters;
+    sSize = size;
+    sExpectAddress = true;
+    sXfer.slaveAddr = (uint8_t)(slaveAddr << 1);
+    sXfer.rxBuff = &sReceived;
+    sXfer.rxSz = RX_SIZE;
+    SetAddress(0);
+    Chip_I2C_SlaveSetup(I2C0, I2C_SLAVE_0, &sXfer, EventHandler, 0);
+    NVIC_EnableIRQ(I2C0_IRQn);
+}
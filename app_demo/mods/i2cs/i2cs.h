@@ -0,0 +1,81 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __I2CS_H_
+#define __I2CS_H_
+
+/** @defgroup MODS_LPC8Nxx_I2CS i2cs: I2C slave register file module
+ * @ingroup MODS_LPC8Nxx
+ * The I2C slave register file module exposes a block of application memory - e.g. the latest temperature, log
+ * statistics and a status word - as the register space of an I2C slave, to be read by an external host MCU.
+ *
+ * The register space follows the common convention of I2C sensors and EEPROMs:
+ * - A write transfer sets the register address with its first byte. Any further bytes are written at the register
+ *  address, which increments with each byte: see @ref I2CS_WRITE_CB.
+ * - A read transfer - typically after a repeated START condition - returns the bytes from the register address on,
+ *  incrementing it with each byte. A read without a preceding write continues where the previous read ended.
+ * - Addresses outside the register space read as 0xFF. After the last register, the address wraps around to 0.
+ * .
+ * The bytes are sent straight from the application memory by the interrupt handler, as the host clocks them out: no
+ * buffer is copied, and the main thread is not involved. The latency seen by the host is bound by the interrupt
+ * handling time alone.
+ *
+ * @par Diversity
+ *  This module supports diversity, like a callback for register writes.
+ *  Check @ref MODS_LPC8Nxx_I2CS_DFT for all diversity parameters.
+ *
+ * @par Usage
+ *  - Initialize the I2C driver with #Chip_I2C_Init and configure the pins.
+ *  - Call #I2cs_Init with the register space: the host can read it from then on.
+ *  - Keep the register space up to date.
+ *  .
+ *
+ * @note The data is live: a value may change between two bytes sent to the host. Update each register with a single
+ *  store of its natural size. When consistency across registers matters, include a sequence number in the register
+ *  space, updated last, and let the host read it before and after.
+ * @note The I2C clock is derived from the System Clock, which is stopped in Deep Sleep: the slave does not respond in
+ *  Deep Sleep.
+ * @note Unless disabled with @ref I2CS_IRQHANDLER, this mod provides an implementation of the interrupt vector
+ *  #I2C0_IRQHandler and enables the interrupt #I2C0_IRQn.
+ *
+ * @{
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include "chip.h"
+#include "app_sel.h"
+#include "i2cs_dft.h"
+
+/* -------------------------------------------------------------------------
+ * Types and defines
+ * ------------------------------------------------------------------------- */
+
+/** The maximum size of the register space: the register address is sent in a single byte. */
+#define I2CS_MAX_SIZE 256
+
+/* -------------------------------------------------------------------------
+ * Exported function prototypes
+ * ------------------------------------------------------------------------- */
+
+/**
+ * Initializes the module: sets up the I2C slave, serving the given register space.
+ * @param slaveAddr : The 7-bit slave address.
+ * @param pRegisters : The register space. May not be @c NULL. Must remain valid for as long as the slave is active.
+ * @param size : The size in bytes of the register space, at most #I2CS_MAX_SIZE.
+ * @pre #Chip_I2C_Init has been called.
+ */
+void I2cs_Init(uint8_t slaveAddr, const volatile void *pRegisters, int size);
+
+#endif /** @} */
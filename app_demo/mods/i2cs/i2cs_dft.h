@@ -0,0 +1,47 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __I2CS_DFT_H_
+#define __I2CS_DFT_H_
+
+/** @defgroup MODS_LPC8Nxx_I2CS_DFT Diversity Settings
+ *  @ingroup MODS_LPC8Nxx_I2CS
+ * These 'defines' capture the diversity settings of the module. The displayed values refer to the default settings.
+ * To override the default settings, place the defines with their desired values in the application app_sel.h header
+ * file: the compiler will pick up your defines before parsing this file.
+ * @{
+ */
+
+/**
+ * Set this define to 0 when another mod provides the interrupt vector #I2C0_IRQHandler, serving slave transfers by
+ * calling #Chip_I2C_SlaveStateHandler: e.g. the i2cm mod.
+ */
+#if (!defined(I2CS_IRQHANDLER))
+    #define I2CS_IRQHANDLER 1
+#endif
+
+/**
+ * By default, the register space is read-only: bytes written after the register address are acknowledged and
+ * discarded. To accept writes, define the function to be called under interrupt for each written byte.
+ * @note The function must have the signature: @code void I2CS_WRITE_CB(int address, uint8_t value) @endcode
+ *  where @c address is the register address, which may lie outside the register space.
+ * @note This must be set to the name of a function, not a pointer to a function: no dereference will be made!
+ */
+#ifndef I2CS_WRITE_CB
+//    #define I2CS_WRITE_CB your_callback
+#endif
+
+/**
+ * @}
+ */
+
+#endif
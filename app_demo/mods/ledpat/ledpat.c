@@ -0,0 +1,107 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include "ledpat.h"
+
+/* -------------------------------------------------------------------------
+ * Private function prototypes
+ * ------------------------------------------------------------------------- */
+
+static void StepCb(uint32_t context);
+
+/* -------------------------------------------------------------------------
+ * Private variables
+ * ------------------------------------------------------------------------- */
+
+static TIMER_T sTimer;
+
+/** The LEDs driven by the playing pattern. */
+static int sLeds;
+
+static const LEDPAT_STEP_T *spSteps;
+static int sCount;
+
+/** The index in spSteps of the current step. */
+static int sStep;
+
+/** The number of times the steps are still to be played, including the current one. 0 when repeating forever. */
+static int sRepeat;
+
+/** The steps used by #LedPat_Blink. */
+static LEDPAT_STEP_T sBlinkSteps[2];
+
+/* -------------------------------------------------------------------------
+ * Private functions
+ * ------------------------------------------------------------------------- */
+
+/** Timer callback: the current step is over. */
+static void StepCb(uint32_t context)
+{
+    (void)context;
+    if (++sStep >= sCount) {
+        sStep = 0;
+        if ((sRepeat > 0) && (--sRepeat == 0)) {
+            LED_Off(sLeds);
+#ifdef LEDPAT_DONE_CB
+            extern void LEDPAT_DONE_CB(void);
+            LEDPAT_DONE_CB();
+#endif
+            return;
+        }
+    }
+    LED_SetState(sLeds, spSteps[sStep].states);
+    Timer_Start(&sTimer, spSteps[sStep].duration, StepCb, 0);
+}
+
+/* -------------------------------------------------------------------------
+ * Exported functions
+ * ------------------------------------------------------------------------- */
+
+void LedPat_Play(int leds, const LEDPAT_STEP_T *pSteps, int count, int repeat)
+{
+    ASSERT((pSteps != NULL) && (count > 0) && (repeat >= 0));
+    LedPat_Stop();
+    sLeds = leds;
+    spSteps = pSteps;
+    sCount = count;
+    sStep = 0;
+    sRepeat = repeat;
+    LED_SetState(sLeds, spSteps[0].states);
+    Timer_Start(&sTimer, spSteps[0].duration, StepCb, 0);
+}
+
+void LedPat_Blink(int leds, uint16_t on, uint16_t off, int repeat)
+{
+    LedPat_Stop(); /* sBlinkSteps may be in use. */
+    sBlinkSteps[0].states = (uint16_t)leds;
+    sBlinkSteps[0].duration = on;
+    sBlinkSteps[1].states = 0;
+    sBlinkSteps[1].duration = off;
+    LedPat_Play(leds, sBlinkSteps, 2, repeat);
+}
+
+void LedPat_Stop(void)
+{
+    if (Timer_IsRunning(&sTimer)) {
+        Timer_Stop(&sTimer);
+        LED_Off(sLeds);
+    }
+}
+
+bool LedPat_IsPlaying(void)
+{
+    return Timer_IsRunning(&sTimer);
+}
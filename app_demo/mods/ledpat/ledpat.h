@@ -0,0 +1,95 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __LEDPAT_H_
+#define __LEDPAT_H_
+
+/** @defgroup MODS_LPC8Nxx_LEDPAT ledpat: LED pattern module
+ * @ingroup MODS_LPC8Nxx
+ * The LED pattern module plays a sequence of LED states on a set of LEDs, each state lasting its own time. Each step
+ * is applied from a software timer callback (see #Timer_Start): blinking takes no polling and no code in the main
+ * loop, and the CPU only wakes up when the LEDs change.
+ *
+ * Dimming is done the same way: a pattern with short on and off steps is a software PWM, with a period of a few
+ * milliseconds. E.g. @code {{LED_RED, 1}, {0, 4}} @endcode repeated forever lights the LED at 20% with a 200 Hz period.
+ * Each step costs a timer interrupt. Both hardware timers are taken - the 16-bit timer by the delay service, the
+ * 32-bit timer by the timer service - so their match outputs cannot drive an LED.
+ *
+ * @par Diversity
+ *  This module supports diversity, like a callback when a pattern is done.
+ *  Check @ref MODS_LPC8Nxx_LEDPAT_DFT for all diversity parameters.
+ *
+ * @par Usage
+ *  - Initialize the LED driver with #LED_Init, and the timer service with #Timer_Init.
+ *  - Call #LedPat_Play with a pattern, or #LedPat_Blink for the common case.
+ *  - Call #LedPat_Stop to end a pattern early.
+ *  .
+ *
+ * @note A running pattern keeps a timer on the 32-bit timer running: see #Timer_IsFastRunning.
+ * @note Only one pattern plays at a time. The LEDs outside the set of the playing pattern can be driven freely.
+ *
+ * @{
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include "board.h"
+#include "timer.h"
+#include "app_sel.h"
+#include "ledpat_dft.h"
+
+/* -------------------------------------------------------------------------
+ * Types and defines
+ * ------------------------------------------------------------------------- */
+
+/** One step of a pattern. */
+typedef struct LEDPAT_STEP_S {
+    uint16_t states; /**< The LEDs that are on during this step, see #LED_SetState. */
+    uint16_t duration; /**< In milliseconds. At least 1. */
+} LEDPAT_STEP_T;
+
+/* -------------------------------------------------------------------------
+ * Exported function prototypes
+ * ------------------------------------------------------------------------- */
+
+/**
+ * Starts playing a pattern. A pattern that is still playing is stopped first: its LEDs are switched off.
+ * @param leds : The LEDs driven by the pattern.
+ * @param pSteps : May not be @c NULL. Must remain valid while the pattern plays.
+ * @param count : The number of steps in @c pSteps. At least 1.
+ * @param repeat : The number of times to play the steps, or @c 0 to repeat them until #LedPat_Stop is called.
+ *  Afterwards, the LEDs are switched off and @ref LEDPAT_DONE_CB is called.
+ */
+void LedPat_Play(int leds, const LEDPAT_STEP_T *pSteps, int count, int repeat);
+
+/**
+ * Starts blinking: a shorthand for a pattern of two steps, on and off.
+ * @param leds : The LEDs to blink.
+ * @param on : The time the LEDs are on, in milliseconds. At least 1.
+ * @param off : The time the LEDs are off, in milliseconds. At least 1.
+ * @param repeat : The number of blinks, or @c 0 to blink until #LedPat_Stop is called.
+ */
+void LedPat_Blink(int leds, uint16_t on, uint16_t off, int repeat);
+
+/**
+ * Stops the pattern, if any, and switches its LEDs off. @ref LEDPAT_DONE_CB is not called.
+ */
+void LedPat_Stop(void);
+
+/**
+ * @return @c true while a pattern is playing.
+ */
+bool LedPat_IsPlaying(void);
+
+#endif /** @} */
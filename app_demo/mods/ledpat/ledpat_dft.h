@@ -0,0 +1,39 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __LEDPAT_DFT_H_
+#define __LEDPAT_DFT_H_
+
+/** @defgroup MODS_LPC8Nxx_LEDPAT_DFT Diversity Settings
+ *  @ingroup MODS_LPC8Nxx_LEDPAT
+ * These 'defines' capture the diversity settings of the module. The displayed values refer to the default settings.
+ * To override the default settings, place the defines with their desired values in the application app_sel.h header
+ * file: the compiler will pick up your defines before parsing this file.
+ * @{
+ */
+
+/**
+ * By default, nothing is notified when a pattern has been played the requested number of times.
+ * Set this define to the function to be called then.
+ * @note The function must have the signature: @code void LEDPAT_DONE_CB(void) @endcode
+ * @note It is called under interrupt. A new pattern may be started from within the callback.
+ * @note This must be set to the name of a function, not a pointer to a function: no dereference will be made!
+ */
+#ifndef LEDPAT_DONE_CB
+//    #define LEDPAT_DONE_CB your_callback
+#endif
+
+/**
+ * @}
+ */
+
+#endif
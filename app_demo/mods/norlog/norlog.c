@@ -0,0 +1,393 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include <string.h>
+#include "norlog.h"
+
+#if (NORLOG_FLASH_OFFSET % NORLOG_SECTOR_SIZE) || (NORLOG_FLASH_SIZE % NORLOG_SECTOR_SIZE) \
+        || (NORLOG_FLASH_SIZE < 3 * NORLOG_SECTOR_SIZE) || (NORLOG_SECTOR_SIZE % NORLOG_PAGE_SIZE)
+    #error NORLOG_FLASH_OFFSET and NORLOG_FLASH_SIZE must select at least 3 whole sectors
+#endif
+
+/* -------------------------------------------------------------------------
+ * Private types and defines
+ * ------------------------------------------------------------------------- */
+
+#define CMD_PAGE_PROGRAM 0x02
+#define CMD_READ 0x03
+#define CMD_READ_STATUS 0x05
+#define CMD_WRITE_ENABLE 0x06
+#define CMD_SECTOR_ERASE 0x20
+#define CMD_POWER_DOWN 0xB9
+#define CMD_RELEASE_POWER_DOWN 0xAB
+
+/** Write In Progress bit of the status register. */
+#define STATUS_WIP 0x01
+
+/** Passed to #Begin for a command without address. */
+#define NO_ADDRESS (-1)
+
+#define SAMPLE_SIZE ((int)sizeof(NORLOG_TYPE))
+#define SAMPLES_PER_PAGE (NORLOG_PAGE_SIZE / SAMPLE_SIZE)
+#define SAMPLES_PER_SECTOR (NORLOG_SECTOR_SIZE / SAMPLE_SIZE)
+#define SECTOR_COUNT (NORLOG_FLASH_SIZE / NORLOG_SECTOR_SIZE)
+#define SAMPLE_COUNT (NORLOG_FLASH_SIZE / SAMPLE_SIZE)
+
+/** The flash address of a sample, given its position in the ring. */
+#define ADDRESS(position) (NORLOG_FLASH_OFFSET + (position) * SAMPLE_SIZE)
+
+/* -------------------------------------------------------------------------
+ * Private function prototypes
+ * ------------------------------------------------------------------------- */
+
+static void Begin(uint8_t command, int address);
+static void End(void);
+static void WaitReady(void);
+static void Read(int address, void *pData, int size);
+static void Program(int address, const void *pData, int size);
+static void Erase(int address);
+static bool IsErased(const void *pData, int size);
+static bool IsSampleErased(int position);
+static bool IsSectorErased(int sector);
+static void Locate(void);
+static void EraseAhead(void);
+
+/* -------------------------------------------------------------------------
+ * Private variables
+ * ------------------------------------------------------------------------- */
+
+/** @c true while a program or erase operation may be ongoing. */
+static bool sBusy = false;
+
+/** The position in the ring where the next sample is written. */
+static int sHead;
+
+/** The number of samples in the log, ending at sHead. */
+static int sCount;
+
+/** The page the write head is in. Holds the samples from the start of the page up to sHead. */
+static NORLOG_TYPE sPage[SAMPLES_PER_PAGE];
+
+/** The position in the ring of sPage[0]. */
+static int sPageStart;
+
+/** The number of samples in sPage. */
+static int sFill;
+
+/** The number of samples in sPage that are programmed. */
+static int sProgrammed;
+
+/* -------------------------------------------------------------------------
+ * Private functions
+ * ------------------------------------------------------------------------- */
+
+/** Selects the flash and sends a command, followed by a 24-bit address unless @c address is #NO_ADDRESS. */
+static void Begin(uint8_t command, int address)
+{
+    uint8_t header[4];
+    uint32_t size = 1;
+
+    header[0] = command;
+    if (address != NO_ADDRESS) {
+        header[1] = (uint8_t)(address >> 16);
+        header[2] = (uint8_t)(address >> 8);
+        header[3] = (uint8_t)address;
+        size = 4;
+    }
+    Chip_GPIO_SetPinOutLow(LPC_GPIO, 0, NORLOG_CS_PIN);
+    Chip_SSP_RWFrames8_Blocking(LPC_SSP0, header, NULL, size);
+}
+
+static void End(void)
+{
+    Chip_GPIO_SetPinOutHigh(LPC_GPIO, 0, NORLOG_CS_PIN);
+}
+
+/** Waits for the last program or erase operation to finish. Sleeps in between polls when a wait is installed. */
+static void WaitReady(void)
+{
+    uint8_t status;
+
+    while (sBusy) {
+        Begin(CMD_READ_STATUS, NO_ADDRESS);
+        Chip_SSP_RWFrames8_Blocking(LPC_SSP0, NULL, &status, 1);
+        End();
+        sBusy = (status & STATUS_WIP) != 0;
+        if (sBusy) {
+            Chip_Clock_System_Wait_us(NORLOG_POLL_INTERVAL);
+        }
+    }
+}
+
+static void Read(int address, void *pData, int size)
+{
+    WaitReady();
+    Begin(CMD_READ, address);
+    Chip_SSP_RWFrames8_Blocking(LPC_SSP0, NULL, (uint8_t *)pData, (uint32_t)size);
+    End();
+}
+
+/** Starts programming, without waiting for it to finish. @pre The data does not cross a page boundary. */
+static void Program(int address, const void *pData, int size)
+{
+    WaitReady();
+    Begin(CMD_WRITE_ENABLE, NO_ADDRESS);
+    End();
+    Begin(CMD_PAGE_PROGRAM, address);
+    Chip_SSP_RWFrames8_Blocking(LPC_SSP0, (const uint8_t *)pData, NULL, (uint32_t)size);
+    End();
+    sBusy = true;
+}
+
+/** Starts erasing the sector at @c address, without waiting for it to finish. */
+static void Erase(int address)
+{
+    WaitReady();
+    Begin(CMD_WRITE_ENABLE, NO_ADDRESS);
+    End();
+    Begin(CMD_SECTOR_ERASE, address);
+    End();
+    sBusy = true;
+}
+
+static bool IsErased(const void *pData, int size)
+{
+    const uint8_t *p = pData;
+
+    while ((size > 0) && (*p == 0xFF)) {
+        p++;
+        size--;
+    }
+    return size == 0;
+}
+
+static bool IsSampleErased(int position)
+{
+    NORLOG_TYPE sample;
+
+    Read(ADDRESS(position), &sample, SAMPLE_SIZE);
+    return IsErased(&sample, SAMPLE_SIZE);
+}
+
+/** Checks all samples of a sector, one page at a time. Overwrites sPage. */
+static bool IsSectorErased(int sector)
+{
+    int position;
+
+    for (position = sector * SAMPLES_PER_SECTOR; position < (sector + 1) * SAMPLES_PER_SECTOR;
+            position += SAMPLES_PER_PAGE) {
+        Read(ADDRESS(position), sPage, NORLOG_PAGE_SIZE);
+        if (!IsErased(sPage, NORLOG_PAGE_SIZE)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Finds the write head back. Samples are written in order, so the sectors holding samples form one run in the ring,
+ * and within the last of these, the written samples form one run from its start. The write head sector is the
+ * written sector followed by an erased one.
+ */
+static void Locate(void)
+{
+    int sector;
+    int headSector = -1;
+    bool firstErased;
+    bool previousErased;
+    bool erased;
+    int low;
+    int high;
+    int middle;
+
+    firstErased = IsSampleErased(0);
+    previousErased = firstErased;
+    for (sector = 1; (sector <= SECTOR_COUNT) && (headSector < 0); sector++) {
+        erased = (sector == SECTOR_COUNT) ? firstErased : IsSampleErased(sector * SAMPLES_PER_SECTOR);
+        if (!previousErased && erased) {
+            headSector = sector - 1;
+        }
+        previousErased = erased;
+    }
+
+    if (headSector < 0) {
+        if (!firstErased) {
+            /* No erased sector: an erase was interrupted. Start all over. */
+            NorLog_Reset();
+        }
+        sHead = 0;
+        sCount = 0;
+    }
+    else {
+        /* The written sectors before the write head sector. */
+        sCount = 0;
+        for (sector = 1; sector < SECTOR_COUNT - 1; sector++) {
+            if (IsSampleErased(((headSector + SECTOR_COUNT - sector) % SECTOR_COUNT) * SAMPLES_PER_SECTOR)) {
+                break;
+            }
+            sCount += SAMPLES_PER_SECTOR;
+        }
+
+        /* Binary search for the first erased sample of the write head sector. Its first sample is written. */
+        low = 1;
+        high = SAMPLES_PER_SECTOR;
+        while (low < high) {
+            middle = (low + high) / 2;
+            if (IsSampleErased(headSector * SAMPLES_PER_SECTOR + middle)) {
+                high = middle;
+            }
+            else {
+                low = middle + 1;
+            }
+        }
+        sHead = (headSector * SAMPLES_PER_SECTOR + low) % SAMPLE_COUNT;
+        sCount += low;
+
+        /* The sector ahead is erased when entering a sector: make up for an erase that was interrupted. An erase
+         * that was cut short may leave the first sample erased and the others not: check the sector as a whole. */
+        sector = (sHead / SAMPLES_PER_SECTOR + 1) % SECTOR_COUNT;
+        if ((sHead % SAMPLES_PER_SECTOR != 0) && !IsSectorErased(sector)) {
+            Erase(ADDRESS(sector * SAMPLES_PER_SECTOR));
+        }
+    }
+
+    sFill = sHead % SAMPLES_PER_PAGE;
+    sProgrammed = sFill;
+    sPageStart = sHead - sFill;
+    if (sFill > 0) {
+        Read(ADDRESS(sPageStart), sPage, sFill * SAMPLE_SIZE);
+    }
+}
+
+/**
+ * Starts erasing the sector after the one the write head enters. The samples in it, if any, are dropped.
+ * @pre sHead is at the start of a sector.
+ */
+static void EraseAhead(void)
+{
+    int ahead = (sHead + SAMPLES_PER_SECTOR) % SAMPLE_COUNT;
+
+    Erase(ADDRESS(ahead));
+    if (sCount > (SECTOR_COUNT - 2) * SAMPLES_PER_SECTOR) {
+        sCount = (SECTOR_COUNT - 2) * SAMPLES_PER_SECTOR;
+    }
+}
+
+/* -------------------------------------------------------------------------
+ * Exported functions
+ * ------------------------------------------------------------------------- */
+
+void NorLog_Init(void)
+{
+    ASSERT((SAMPLES_PER_PAGE * SAMPLE_SIZE == NORLOG_PAGE_SIZE) && (SAMPLE_SIZE <= NORLOG_PAGE_SIZE));
+    Chip_GPIO_SetPinOutHigh(LPC_GPIO, 0, NORLOG_CS_PIN);
+    Chip_GPIO_SetPinDIROutput(LPC_GPIO, 0, NORLOG_CS_PIN);
+    Chip_SSP_Enable(LPC_SSP0);
+
+    Begin(CMD_RELEASE_POWER_DOWN, NO_ADDRESS);
+    End();
+    Chip_Clock_System_Wait_us(NORLOG_RESUME_TIME);
+    sBusy = true; /* An operation started before a reset may still be ongoing. */
+    Locate();
+}
+
+void NorLog_DeInit(void)
+{
+    NorLog_Flush(true);
+    Begin(CMD_POWER_DOWN, NO_ADDRESS);
+    End();
+}
+
+void NorLog_Reset(void)
+{
+    int sector;
+
+    for (sector = 0; sector < SECTOR_COUNT; sector++) {
+        if (!IsSampleErased(sector * SAMPLES_PER_SECTOR)) {
+            Erase(ADDRESS(sector * SAMPLES_PER_SECTOR));
+        }
+    }
+    sHead = 0;
+    sCount = 0;
+    sPageStart = 0;
+    sFill = 0;
+    sProgrammed = 0;
+}
+
+int NorLog_GetCount(void)
+{
+    return sCount;
+}
+
+void NorLog_Write(const NORLOG_TYPE *pSamples, int n)
+{
+    ASSERT((pSamples != NULL) && (n >= 0));
+    while (n > 0) {
+        ASSERT(!IsErased(pSamples, SAMPLE_SIZE));
+        if (sHead % SAMPLES_PER_SECTOR == 0) {
+            EraseAhead();
+        }
+        sPage[sFill++] = *pSamples++;
+        sHead = (sHead + 1) % SAMPLE_COUNT;
+        sCount++;
+        n--;
+        if (sFill == SAMPLES_PER_PAGE) {
+            NorLog_Flush(false);
+            sPageStart = sHead;
+            sFill = 0;
+            sProgrammed = 0;
+        }
+    }
+}
+
+void NorLog_Read(NORLOG_TYPE *pSamples, int index, int n)
+{
+    int position;
+    int distance; /* From position up to the write head. */
+    int chunk;
+
+    ASSERT((pSamples != NULL) && (index >= 0) && (n >= 0) && (index + n <= sCount));
+    position = (sHead + SAMPLE_COUNT - sCount + index) % SAMPLE_COUNT;
+    while (n > 0) {
+        distance = (sHead + SAMPLE_COUNT - position) % SAMPLE_COUNT;
+        if (distance <= sFill) {
+            /* From the page buffer. */
+            chunk = (n < distance) ? n : distance;
+            memcpy(pSamples, &sPage[sFill - distance], (size_t)(chunk * SAMPLE_SIZE));
+        }
+        else {
+            /* From the flash, up to the page buffer or the end of the ring. */
+            chunk = distance - sFill;
+            chunk = (chunk < SAMPLE_COUNT - position) ? chunk : SAMPLE_COUNT - position;
+            chunk = (chunk < n) ? chunk : n;
+            Read(ADDRESS(position), pSamples, chunk * SAMPLE_SIZE);
+        }
+        position = (position + chunk) % SAMPLE_COUNT;
+        pSamples += chunk;
+        n -= chunk;
+    }
+}
+
+void NorLog_Flush(bool wait)
+{
+    if (sFill > sProgrammed) {
+        Program(ADDRESS(sPageStart + sProgrammed), &sPage[sProgrammed], (sFill - sProgrammed) * SAMPLE_SIZE);
+        sProgrammed = sFill;
+    }
+    if (wait) {
+        WaitReady();
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __NORLOG_H_
+#define __NORLOG_H_
+
+/** @defgroup MODS_LPC8Nxx_NORLOG norlog: External SPI NOR flash log module
+ * @ingroup MODS_LPC8Nxx
+ * The NOR flash log module keeps a log of samples in an external SPI NOR flash. Where the internal EEPROM holds some
+ * kilobytes, a common 8 Mbit flash holds about half a million 16-bit samples.
+ *
+ * The log is a ring buffer over the sectors of the flash:
+ * - Samples are collected in a page buffer in RAM, and programmed with one page program command per page.
+ * - When the write head enters a sector, the next sector is erased. The erase takes place while the samples of the
+ *  current sector are collected: a write never waits for an erase. Once the flash is full, this drops the oldest
+ *  sector of samples.
+ * - Program and erase operations are started, and only waited for by the next operation on the flash.
+ * - Reads return the samples in order, from the flash or from the page buffer: samples that were not flushed yet can
+ *  be exported as well.
+ * .
+ * The log keeps no administration: #NorLog_Init finds the write head back from the flash content. An erased sample
+ * marks the end of the log.
+ *
+ * @par Diversity
+ *  This module supports diversity, like the type of a sample, the chip select pin and the flash geometry.
+ *  Check @ref MODS_LPC8Nxx_NORLOG_DFT for all diversity parameters.
+ *
+ * @par Usage
+ *  - Initialize the SSP driver as master with #Chip_SSP_Init, set the format - 8 bits, SPI mode 0 - and the bit rate,
+ *    and configure the SSP pins.
+ *  - Call #NorLog_Init.
+ *  - Call #NorLog_Write to add samples, #NorLog_GetCount and #NorLog_Read to export them.
+ *  - Call #NorLog_Flush before a power mode in which RAM content is lost, or #NorLog_DeInit to also put the flash in
+ *    Deep Power Down.
+ *  .
+ *
+ * @note This module uses the blocking API of the SSP driver. Do not call it while other SSP transfers are ongoing.
+ * @note None of the functions may be called under interrupt.
+ *
+ * @{
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include "chip.h"
+#include "app_sel.h"
+#include "norlog_dft.h"
+
+/* -------------------------------------------------------------------------
+ * Exported function prototypes
+ * ------------------------------------------------------------------------- */
+
+/**
+ * Initializes the module: wakes up the flash, and finds the samples logged earlier.
+ * Scans the first sample of each sector, a few samples of the last written sector, and the whole sector ahead of the
+ * write head.
+ * @pre The SSP driver is initialized, and the pins are configured.
+ */
+void NorLog_Init(void);
+
+/**
+ * Puts the flash in Deep Power Down, after flushing the page buffer.
+ * @post Call #NorLog_Init before using the log again.
+ */
+void NorLog_DeInit(void);
+
+/**
+ * Forgets all samples: erases all sectors holding samples.
+ * @note Takes up to one sector erase time per sector holding samples.
+ */
+void NorLog_Reset(void);
+
+/**
+ * @return The number of samples in the log.
+ */
+int NorLog_GetCount(void);
+
+/**
+ * Adds samples to the log. The oldest samples are dropped, one sector at a time, when the flash is full.
+ * @param pSamples : May not be @c NULL. No sample may have all bits set.
+ * @param n : The number of samples to add.
+ * @note The samples are programmed as each page of the page buffer fills up. Call #NorLog_Flush to program a partly
+ *  filled page.
+ */
+void NorLog_Write(const NORLOG_TYPE *pSamples, int n);
+
+/**
+ * Retrieves samples from the log.
+ * @param pSamples : May not be @c NULL. Will be filled in with @c n samples.
+ * @param index : The index of the first sample to retrieve. The oldest sample has index 0.
+ * @param n : The number of samples to retrieve. @c index + @c n may not exceed #NorLog_GetCount.
+ * @note Waits for an ongoing erase operation: typically some tens of milliseconds.
+ */
+void NorLog_Read(NORLOG_TYPE *pSamples, int index, int n);
+
+/**
+ * Programs the samples in the page buffer that were not programmed yet.
+ * @param wait : Indicates if the function needs to wait till the flash has been programmed.
+ * @note The flash is programmed in parts: a page is programmed at most once per call to this function.
+ */
+void NorLog_Flush(bool wait);
+
+#endif /** @} */
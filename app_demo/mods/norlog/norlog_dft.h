@@ -0,0 +1,88 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __NORLOG_DFT_H_
+#define __NORLOG_DFT_H_
+
+/** @defgroup MODS_LPC8Nxx_NORLOG_DFT Diversity Settings
+ *  @ingroup MODS_LPC8Nxx_NORLOG
+ * These 'defines' capture the diversity settings of the module. The displayed values refer to the default settings.
+ * To override the default settings, place the defines with their desired values in the application app_sel.h header
+ * file: the compiler will pick up your defines before parsing this file.
+ * @{
+ */
+
+/**
+ * The type of one sample. Its size must be a power of two, at most #NORLOG_PAGE_SIZE.
+ * @note A sample with all bits set is indistinguishable from erased flash, and may not be written.
+ */
+#if (!defined(NORLOG_TYPE))
+    #define NORLOG_TYPE int16_t
+#endif
+
+/**
+ * The PIO0 pin used as active low chip select of the flash. It is driven as GPIO by this module.
+ */
+#if (!defined(NORLOG_CS_PIN))
+    #define NORLOG_CS_PIN 2
+#endif
+
+/**
+ * The address of the first byte of the flash used for the log. Must be a multiple of #NORLOG_SECTOR_SIZE.
+ */
+#if (!defined(NORLOG_FLASH_OFFSET))
+    #define NORLOG_FLASH_OFFSET 0
+#endif
+
+/**
+ * The number of bytes of the flash used for the log. Must be a multiple of #NORLOG_SECTOR_SIZE, and span at least 3
+ * sectors. The default value corresponds to an 8 Mbit flash, used as a whole.
+ */
+#if (!defined(NORLOG_FLASH_SIZE))
+    #define NORLOG_FLASH_SIZE 0x100000
+#endif
+
+/**
+ * The size in bytes of the smallest erasable unit of the flash: the unit erased by the sector erase command (0x20).
+ */
+#if (!defined(NORLOG_SECTOR_SIZE))
+    #define NORLOG_SECTOR_SIZE 4096
+#endif
+
+/**
+ * The size in bytes of the largest unit programmed by one page program command (0x02). This is also the size of the
+ * page buffer kept in RAM.
+ */
+#if (!defined(NORLOG_PAGE_SIZE))
+    #define NORLOG_PAGE_SIZE 256
+#endif
+
+/**
+ * The time in microseconds between two polls of the status register, while waiting for a program or erase operation.
+ * The wait uses #Chip_Clock_System_Wait_us.
+ */
+#if (!defined(NORLOG_POLL_INTERVAL))
+    #define NORLOG_POLL_INTERVAL 100
+#endif
+
+/**
+ * The time in microseconds the flash needs to release from Deep Power Down.
+ */
+#if (!defined(NORLOG_RESUME_TIME))
+    #define NORLOG_RESUME_TIME 50
+#endif
+
+/**
+ * @}
+ */
+
+#endif
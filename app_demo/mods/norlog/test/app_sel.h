@@ -0,0 +1,24 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/* A small flash geometry, so that every program and erase operation of a few ring cycles can be interrupted. */
+
+#ifndef __APP_SEL_H_
+#define __APP_SEL_H_
+
+#define NORLOG_CS_PIN 2
+#define NORLOG_FLASH_OFFSET 0x100
+#define NORLOG_FLASH_SIZE 0x100 /**< 4 sectors of 32 samples. */
+#define NORLOG_SECTOR_SIZE 0x40
+#define NORLOG_PAGE_SIZE 0x10 /**< 8 samples. */
+
+#endif
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/* Host stand-in for the chip library: only what the norlog mod uses. Implemented by the flash model in
+ * norlog_test.c. */
+
+#ifndef __CHIP_H_
+#define __CHIP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <assert.h>
+
+#define ASSERT(expression) assert(expression)
+
+typedef struct LPC_GPIO_S LPC_GPIO_T;
+typedef struct LPC_SSP_S LPC_SSP_T;
+
+#define LPC_GPIO ((LPC_GPIO_T *)NULL)
+#define LPC_SSP0 ((LPC_SSP_T *)NULL)
+
+void Chip_GPIO_SetPinOutHigh(LPC_GPIO_T *pGPIO, uint8_t port, uint8_t pin);
+void Chip_GPIO_SetPinOutLow(LPC_GPIO_T *pGPIO, uint8_t port, uint8_t pin);
+void Chip_GPIO_SetPinDIROutput(LPC_GPIO_T *pGPIO, uint8_t port, uint8_t pin);
+void Chip_SSP_Enable(LPC_SSP_T *pSSP);
+uint32_t Chip_SSP_RWFrames8_Blocking(LPC_SSP_T *pSSP, const uint8_t *pTx, uint8_t *pRx, uint32_t count);
+void Chip_Clock_System_Wait_us(uint32_t us);
+
+#endif
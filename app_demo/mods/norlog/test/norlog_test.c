@@ -0,0 +1,498 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/*
+ * Host test of the norlog mod. The chip library is replaced by a model of an SPI NOR flash (see chip.h), which checks
+ * the command sequences, and which can cut the power during any program or erase operation. After each cut, the log
+ * is initialized again as after a reset, and is checked to hold the samples written before, minus at most the samples
+ * that were not programmed yet, to accept new samples, and to never program bytes that are not erased.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <setjmp.h>
+#include "norlog.h"
+
+/* ------------------------------------------------------------------------- */
+
+#define MEMORY_SIZE (NORLOG_FLASH_OFFSET + NORLOG_FLASH_SIZE)
+#define SAMPLES_PER_SECTOR (NORLOG_SECTOR_SIZE / (int)sizeof(NORLOG_TYPE))
+#define SAMPLES_PER_PAGE (NORLOG_PAGE_SIZE / (int)sizeof(NORLOG_TYPE))
+#define SECTOR_COUNT (NORLOG_FLASH_SIZE / NORLOG_SECTOR_SIZE)
+#define SAMPLE_COUNT (NORLOG_FLASH_SIZE / (int)sizeof(NORLOG_TYPE))
+
+/** Value of the first sample written after recovering from a power cut. */
+#define RESUME_VALUE 20000
+
+/** How much of a sector is erased when the power is cut during its erase. */
+typedef enum ERASE_CUT {
+    ERASE_CUT_NONE, /**< Nothing. */
+    ERASE_CUT_FIRST_SAMPLE, /**< Only the first sample: the sector looks erased when checking its start. */
+    ERASE_CUT_HALF, /**< The first half. */
+    ERASE_CUT_ALL_BUT_LAST, /**< All bytes except the last one. */
+    ERASE_CUT_COUNT
+} ERASE_CUT_T;
+
+#define CHECK(condition) Check((condition), #condition, __LINE__)
+
+/* ------------------------------------------------------------------------- */
+
+static uint8_t sMemory[MEMORY_SIZE];
+static bool sSelected;
+static int sFrame; /**< The number of frames exchanged since the flash was selected. */
+static uint8_t sCommand;
+static uint32_t sAddress;
+static uint8_t sData[NORLOG_PAGE_SIZE + 1];
+static int sDataCount;
+static bool sWriteEnabled;
+static int sBusyPolls; /**< The number of status reads for which the last operation still reports being busy. */
+
+static int sOperations; /**< The number of program and erase operations started. */
+static int sCutAt; /**< The power is cut during this operation. 0 for never. */
+static ERASE_CUT_T sEraseCut;
+static bool sCutDuringProgram;
+static jmp_buf sPowerCut;
+
+/** The value of the last sample of the last completed program operation. */
+static NORLOG_TYPE sDurable;
+
+/** The value of the next sample to write. */
+static NORLOG_TYPE sNext;
+/** The page buffer is flushed after each sample with a value that is a multiple of this. */
+static int sFlushEvery;
+
+static int sFailures;
+static const char *sCase;
+
+/* ------------------------------------------------------------------------- */
+
+static void Check(bool condition, const char *text, int line)
+{
+    if (!condition) {
+        if (sFailures < 20) {
+            printf("FAIL line %d: %s [%s]\n", line, text, sCase);
+        }
+        sFailures++;
+    }
+}
+
+/** Executes the command that was sent, when the flash is deselected. */
+static void Execute(void)
+{
+    int n;
+
+    if ((sCommand == 0x02) || (sCommand == 0x20)) {
+        CHECK(sWriteEnabled);
+        CHECK(sFrame >= 4);
+        sWriteEnabled = false;
+        sOperations++;
+        if (sCommand == 0x02) {
+            CHECK(sDataCount <= NORLOG_PAGE_SIZE);
+            CHECK((sAddress % NORLOG_PAGE_SIZE) + (uint32_t)sDataCount <= NORLOG_PAGE_SIZE);
+            CHECK(sAddress + (uint32_t)sDataCount <= MEMORY_SIZE);
+            for (n = 0; n < sDataCount; n++) {
+                CHECK(sMemory[sAddress + (uint32_t)n] == 0xFF);
+            }
+            if (sOperations == sCutAt) {
+                sCutDuringProgram = true;
+                sDataCount /= 2;
+            }
+            for (n = 0; n < sDataCount; n++) {
+                sMemory[sAddress + (uint32_t)n] &= sData[n];
+            }
+            if ((sOperations != sCutAt) && (sDataCount >= (int)sizeof(NORLOG_TYPE))) {
+                memcpy(&sDurable, &sData[sDataCount - (int)sizeof(NORLOG_TYPE)], sizeof(NORLOG_TYPE));
+            }
+        }
+        else {
+            CHECK(sAddress % NORLOG_SECTOR_SIZE == 0);
+            CHECK(sAddress + NORLOG_SECTOR_SIZE <= MEMORY_SIZE);
+            n = NORLOG_SECTOR_SIZE;
+            if (sOperations == sCutAt) {
+                n = (sEraseCut == ERASE_CUT_NONE) ? 0 :
+                    (sEraseCut == ERASE_CUT_FIRST_SAMPLE) ? (int)sizeof(NORLOG_TYPE) :
+                    (sEraseCut == ERASE_CUT_HALF) ? NORLOG_SECTOR_SIZE / 2 : NORLOG_SECTOR_SIZE - 1;
+            }
+            memset(&sMemory[sAddress], 0xFF, (size_t)n);
+        }
+        if (sOperations == sCutAt) {
+            longjmp(sPowerCut, 1);
+        }
+        sBusyPolls = 2;
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+void Chip_GPIO_SetPinOutHigh(LPC_GPIO_T *pGPIO, uint8_t port, uint8_t pin)
+{
+    (void)pGPIO;
+    CHECK((port == 0) && (pin == NORLOG_CS_PIN));
+    if (sSelected) {
+        sSelected = false;
+        Execute();
+    }
+}
+
+void Chip_GPIO_SetPinOutLow(LPC_GPIO_T *pGPIO, uint8_t port, uint8_t pin)
+{
+    (void)pGPIO;
+    CHECK((port == 0) && (pin == NORLOG_CS_PIN));
+    CHECK(!sSelected);
+    sSelected = true;
+    sFrame = 0;
+    sDataCount = 0;
+}
+
+void Chip_GPIO_SetPinDIROutput(LPC_GPIO_T *pGPIO, uint8_t port, uint8_t pin)
+{
+    (void)pGPIO;
+    CHECK((port == 0) && (pin == NORLOG_CS_PIN));
+}
+
+void Chip_SSP_Enable(LPC_SSP_T *pSSP)
+{
+    (void)pSSP;
+}
+
+void Chip_Clock_System_Wait_us(uint32_t us)
+{
+    (void)us;
+}
+
+uint32_t Chip_SSP_RWFrames8_Blocking(LPC_SSP_T *pSSP, const uint8_t *pTx, uint8_t *pRx, uint32_t count)
+{
+    uint32_t n;
+    uint8_t in;
+    uint8_t out;
+
+    (void)pSSP;
+    CHECK(sSelected);
+    for (n = 0; n < count; n++) {
+        in = pTx ? pTx[n] : 0xFF;
+        out = 0xFF;
+        if (sFrame == 0) {
+            sCommand = in;
+            sAddress = 0;
+            /* Only the status may be read while an operation is ongoing. */
+            CHECK((sBusyPolls == 0) || (sCommand == 0x05));
+            if (sCommand == 0x06) {
+                sWriteEnabled = true;
+            }
+        }
+        else if (sCommand == 0x05) {
+            out = (sBusyPolls > 0) ? 0x01 : 0x00;
+            if (sBusyPolls > 0) {
+                sBusyPolls--;
+            }
+        }
+        else if (((sCommand == 0x02) || (sCommand == 0x03) || (sCommand == 0x20)) && (sFrame < 4)) {
+            sAddress = (sAddress << 8) | in;
+        }
+        else if (sCommand == 0x03) {
+            CHECK(sAddress < MEMORY_SIZE);
+            out = sMemory[sAddress++ % MEMORY_SIZE];
+        }
+        else if (sCommand == 0x02) {
+            CHECK(sDataCount < (int)sizeof(sData));
+            if (sDataCount < (int)sizeof(sData)) {
+                sData[sDataCount++] = in;
+            }
+        }
+        if (pRx) {
+            pRx[n] = out;
+        }
+        sFrame++;
+    }
+    return count;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/** A reset: the flash aborts any operation, and the mod loses its RAM content. */
+static void Reset(void)
+{
+    sSelected = false;
+    sWriteEnabled = false;
+    sBusyPolls = 0;
+    NorLog_Init();
+}
+
+static void Write(int n)
+{
+    while (n > 0) {
+        NorLog_Write(&sNext, 1);
+        n--;
+        if (sNext % sFlushEvery == 0) {
+            NorLog_Flush(false);
+        }
+        sNext++;
+    }
+}
+
+static void Workload(void)
+{
+    Write(2 * SAMPLES_PER_SECTOR + 7);
+    NorLog_Flush(true);
+}
+
+/** @return @c false if the power was cut while running @c fn. */
+static bool Run(void (*fn)(void))
+{
+    if (setjmp(sPowerCut) == 0) {
+        fn();
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Checks that the log holds a run of consecutive samples from @c first up to @c last, preceded by at most one corrupt
+ * sample, preceded by a run of consecutive samples ending at or after @c durable. Only whole sectors are dropped, and
+ * never the last two: the log holds at least @c written samples, or as many as fit in all sectors but two.
+ */
+static void CheckLog(NORLOG_TYPE durable, NORLOG_TYPE first, NORLOG_TYPE last, bool corruptAllowed, int written)
+{
+    static NORLOG_TYPE samples[SAMPLE_COUNT];
+    int count = NorLog_GetCount();
+    int n = count;
+    NORLOG_TYPE expected = last;
+
+    CHECK((count > 0) && (count <= SAMPLE_COUNT));
+    if ((count <= 0) || (count > SAMPLE_COUNT)) {
+        return;
+    }
+    NorLog_Read(samples, 0, count);
+    while ((n > 0) && (expected >= first)) {
+        CHECK(samples[n - 1] == expected);
+        n--;
+        expected--;
+    }
+    if ((n > 0) && corruptAllowed && ((n < 2) || (samples[n - 1] != samples[n - 2] + 1))) {
+        n--;
+    }
+    if (n > 0) {
+        CHECK(samples[n - 1] >= durable);
+        CHECK(samples[n - 1] < first);
+        for (; n > 1; n--) {
+            CHECK(samples[n - 2] + 1 == samples[n - 1]);
+        }
+    }
+    if (written > (SECTOR_COUNT - 2) * SAMPLES_PER_SECTOR) {
+        written = (SECTOR_COUNT - 2) * SAMPLES_PER_SECTOR;
+    }
+    CHECK(count >= written);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/** Samples are retrieved in order, from the flash and from the page buffer, also across the end of the ring. */
+static void TestWriteRead(void)
+{
+    int n;
+
+    sCase = "write and read";
+    sNext = 1;
+    sFlushEvery = 5;
+    memset(sMemory, 0xFF, sizeof(sMemory));
+    sCutAt = 0;
+    Reset();
+    CHECK(NorLog_GetCount() == 0);
+    for (n = 0; n < 3 * SAMPLE_COUNT; n++) {
+        Write(1);
+        CheckLog(0, 1, (NORLOG_TYPE)(sNext - 1), false, sNext - 1);
+    }
+    NorLog_Flush(true);
+    n = NorLog_GetCount();
+    Reset();
+    CHECK(NorLog_GetCount() == n);
+    CheckLog(0, 1, (NORLOG_TYPE)(sNext - 1), false, sNext - 1);
+
+    NorLog_Reset();
+    CHECK(NorLog_GetCount() == 0);
+    Reset();
+    CHECK(NorLog_GetCount() == 0);
+}
+
+/** A reset after each sample, without flushing: only the samples in the page buffer are lost. */
+static void TestResetAfterEachSample(void)
+{
+    NORLOG_TYPE last;
+    int n;
+
+    sCase = "reset after each sample";
+    sNext = 1;
+    sFlushEvery = 3;
+    memset(sMemory, 0xFF, sizeof(sMemory));
+    sCutAt = 0;
+    sDurable = 0;
+    Reset();
+    for (n = 0; n < 2 * SAMPLE_COUNT; n++) {
+        Write(1);
+        Reset();
+        if (NorLog_GetCount() > 0) {
+            CheckLog(sDurable, sNext, (NORLOG_TYPE)(sNext - 1), false, sDurable);
+            NorLog_Read(&last, NorLog_GetCount() - 1, 1);
+            CHECK(last == sDurable);
+        }
+        else {
+            CHECK(sDurable == 0);
+        }
+        /* Continue after the last sample kept. */
+        sNext = (NORLOG_TYPE)(sDurable + 1);
+    }
+}
+
+/**
+ * The sector ahead of the write head is left partly erased, as by an erase that was cut short, also when the repair
+ * is cut short again. It must be erased before the write head enters it. A sector of which the first sample is not
+ * erased holds samples for the mod: that case is not part of this test.
+ */
+static void TestSectorAheadPartlyErased(void)
+{
+    static char text[100];
+    int eraseCut;
+    int recoveryCut;
+    int ahead;
+
+    sCase = text;
+    for (eraseCut = ERASE_CUT_FIRST_SAMPLE; eraseCut < ERASE_CUT_COUNT; eraseCut++) {
+        for (recoveryCut = 0; recoveryCut <= 1; recoveryCut++) {
+            snprintf(text, sizeof(text), "sector ahead, erase cut %d, repair cut %d", eraseCut, recoveryCut);
+            sEraseCut = (ERASE_CUT_T)eraseCut;
+            memset(sMemory, 0xFF, sizeof(sMemory));
+            sCutAt = 0;
+            sDurable = 0;
+            Reset();
+            sNext = 1;
+            sFlushEvery = 3;
+            Write(SAMPLES_PER_SECTOR + 5);
+            NorLog_Flush(true);
+
+            /* Old samples, of which only a part was erased. */
+            ahead = NORLOG_FLASH_OFFSET + 2 * NORLOG_SECTOR_SIZE;
+            memset(&sMemory[ahead], 0x00, NORLOG_SECTOR_SIZE);
+            sOperations = 0;
+            sCutAt = 1;
+            sWriteEnabled = true;
+            sCommand = 0x20;
+            sAddress = (uint32_t)ahead;
+            sFrame = 4;
+            if (Run(Execute)) {
+                CHECK(false);
+            }
+
+            sOperations = 0;
+            sCutAt = recoveryCut;
+            if (!Run(Reset)) {
+                sCutAt = 0;
+                Reset();
+            }
+            sCutAt = 0;
+            CheckLog(sDurable, sNext, (NORLOG_TYPE)(sNext - 1), false, sDurable);
+            Write(2 * SAMPLES_PER_SECTOR);
+            NorLog_Flush(true);
+            Reset();
+            CheckLog(sDurable, sNext, (NORLOG_TYPE)(sNext - 1), false, sDurable);
+        }
+    }
+}
+
+/**
+ * The power is cut during each program and erase operation in turn, also during the recovery after a first cut. The
+ * log is then checked, extended, and checked again.
+ */
+static void TestPowerCut(void)
+{
+    static const int flushes[] = {1, 3, SAMPLES_PER_PAGE};
+    static const int prefills[] = {0, SAMPLES_PER_SECTOR / 2, SAMPLE_COUNT + SAMPLES_PER_SECTOR / 2 + 3};
+    static char text[100];
+    NORLOG_TYPE durable;
+    int f;
+    int p;
+    int cut;
+    int recoveryCut;
+    int eraseCut;
+    bool completed;
+    bool corrupt;
+
+    sCase = text;
+    for (eraseCut = 0; eraseCut < ERASE_CUT_COUNT; eraseCut++) {
+        for (p = 0; p < (int)(sizeof(prefills) / sizeof(prefills[0])); p++) {
+            for (f = 0; f < (int)(sizeof(flushes) / sizeof(flushes[0])); f++) {
+                for (recoveryCut = 0; recoveryCut <= 2; recoveryCut++) {
+                    completed = false;
+                    for (cut = 1; !completed; cut++) {
+                        snprintf(text, sizeof(text), "erase cut %d, prefill %d, flush every %d, cut %d then %d",
+                                 eraseCut, prefills[p], flushes[f], cut, recoveryCut);
+                        sEraseCut = (ERASE_CUT_T)eraseCut;
+                        memset(sMemory, 0xFF, sizeof(sMemory));
+                        sCutAt = 0;
+                        sDurable = 0;
+                        Reset();
+                        sNext = 1;
+                        sFlushEvery = flushes[f];
+                        Write(prefills[p]);
+                        NorLog_Flush(true);
+
+                        sOperations = 0;
+                        sCutAt = cut;
+                        sCutDuringProgram = false;
+                        completed = Run(Workload);
+                        corrupt = sCutDuringProgram;
+
+                        /* Recover, possibly with another power cut. */
+                        sOperations = 0;
+                        sCutAt = recoveryCut;
+                        if (!Run(Reset)) {
+                            corrupt = corrupt || sCutDuringProgram;
+                            sCutAt = 0;
+                            Reset();
+                        }
+                        sCutAt = 0;
+                        durable = sDurable;
+                        if (NorLog_GetCount() > 0) {
+                            CheckLog(durable, sNext, (NORLOG_TYPE)(sNext - 1), corrupt, durable);
+                        }
+                        else {
+                            CHECK(durable == 0);
+                        }
+
+                        /* The log continues, and survives a reset. */
+                        sNext = RESUME_VALUE;
+                        Write(SAMPLES_PER_SECTOR + 3);
+                        NorLog_Flush(true);
+                        Reset();
+                        CheckLog(durable, RESUME_VALUE, (NORLOG_TYPE)(sNext - 1), corrupt,
+                                 durable + SAMPLES_PER_SECTOR + 3);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+int main(void)
+{
+    TestWriteRead();
+    TestResetAfterEachSample();
+    TestSectorAheadPartlyErased();
+    TestPowerCut();
+    if (sFailures) {
+        printf("%d failures\n", sFailures);
+        return 1;
+    }
+    printf("norlog: all tests passed\n");
+    return 0;
+}
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include "spim.h"
+
+/* -------------------------------------------------------------------------
+ * Private function prototypes
+ * ------------------------------------------------------------------------- */
+
+static void Activity(bool active);
+static void Start(SPIM_XFER_T *pXfer);
+static void Fill(SPIM_XFER_T *pXfer);
+static void Drain(SPIM_XFER_T *pXfer);
+static void Finish(SPIM_STATUS_T status);
+
+/* -------------------------------------------------------------------------
+ * Private variables
+ * ------------------------------------------------------------------------- */
+
+/** The transfer in progress, followed by the queued transfers. @c NULL when idle. */
+static SPIM_XFER_T * volatile sHead = NULL;
+
+/** The last queued transfer. Only valid when sHead is not @c NULL. */
+static SPIM_XFER_T *sTail;
+
+/** The number of frames of the transfer in progress written to the TX FIFO, resp. read from the RX FIFO. */
+static int sTxCount;
+static int sRxCount;
+
+/** @c true when the frames of the transfer in progress are wider than 8 bits. */
+static bool sWide;
+
+/* -------------------------------------------------------------------------
+ * Private functions
+ * ------------------------------------------------------------------------- */
+
+static void Activity(bool active)
+{
+#if defined(SPIM_ACTIVITY_CB)
+    extern void SPIM_ACTIVITY_CB(bool active);
+    SPIM_ACTIVITY_CB(active);
+#else
+    (void)active;
+#endif
+}
+
+/** @pre Interrupts are disabled, or called from the interrupt handler. */
+static void Start(SPIM_XFER_T *pXfer)
+{
+    sTxCount = 0;
+    sRxCount = 0;
+    sWide = Chip_SSP_GetDataSize(LPC_SSP0) > SSP_BITS_8;
+    if (pXfer->csPin != SPIM_NO_CS) {
+        Chip_GPIO_SetPinOutLow(LPC_GPIO, 0, (uint8_t)pXfer->csPin);
+    }
+    Fill(pXfer);
+    LPC_SSP0->IMSC = SSP_RORIM | SSP_RTIM | SSP_RXIM | ((sTxCount < pXfer->length) ? SSP_TXIM : 0);
+}
+
+/**
+ * Writes frames to the TX FIFO in one burst. The frames in flight - written but not yet read back - never exceed the
+ * FIFO depth: the TX FIFO always has room, and the RX FIFO cannot overrun. No status needs to be read.
+ */
+static void Fill(SPIM_XFER_T *pXfer)
+{
+    int end = sRxCount + SSP_FIFO_DEPTH;
+
+    if (end > pXfer->length) {
+        end = pXfer->length;
+    }
+    if (pXfer->pTx == NULL) {
+        while (sTxCount < end) {
+            LPC_SSP0->DR = 0xFFFF;
+            sTxCount++;
+        }
+    }
+    else if (sWide) {
+        const uint16_t *p = (const uint16_t *)pXfer->pTx;
+        while (sTxCount < end) {
+            LPC_SSP0->DR = p[sTxCount++];
+        }
+    }
+    else {
+        const uint8_t *p = (const uint8_t *)pXfer->pTx;
+        while (sTxCount < end) {
+            LPC_SSP0->DR = p[sTxCount++];
+        }
+    }
+}
+
+static void Drain(SPIM_XFER_T *pXfer)
+{
+    uint16_t frame;
+
+    while ((sRxCount < pXfer->length) && (LPC_SSP0->SR & SSP_STAT_RNE)) {
+        frame = (uint16_t)LPC_SSP0->DR;
+        if (pXfer->pRx == NULL) {
+            /* Discard. */
+        }
+        else if (sWide) {
+            ((uint16_t *)pXfer->pRx)[sRxCount] = frame;
+        }
+        else {
+            ((uint8_t *)pXfer->pRx)[sRxCount] = (uint8_t)frame;
+        }
+        sRxCount++;
+    }
+}
+
+/**
+ * Ends the transfer in progress, and starts the next one before reporting the completed one.
+ * @pre Called from the interrupt handler.
+ */
+static void Finish(SPIM_STATUS_T status)
+{
+    SPIM_XFER_T *pXfer = sHead;
+
+    LPC_SSP0->IMSC = 0;
+    if (status != SPIM_STATUS_DONE) {
+        Chip_SSP_Int_FlushData(LPC_SSP0);
+    }
+    /* All frames have been received back: the last one has been clocked out completely. */
+    if ((pXfer->csPin != SPIM_NO_CS) && (!pXfer->hold || (status != SPIM_STATUS_DONE))) {
+        Chip_GPIO_SetPinOutHigh(LPC_GPIO, 0, (uint8_t)pXfer->csPin);
+    }
+    pXfer->status = status;
+
+    sHead = pXfer->pNext;
+    pXfer->pNext = NULL;
+    if (sHead != NULL) {
+        Start(sHead);
+    }
+    else {
+        Activity(false);
+    }
+
+    if (pXfer->cb != NULL) {
+        pXfer->cb(pXfer);
+    }
+}
+
+/* -------------------------------------------------------------------------
+ * Exported functions
+ * ------------------------------------------------------------------------- */
+
+void SSP0_IRQHandler(void)
+{
+    SPIM_XFER_T *pXfer = sHead;
+
+    if (pXfer == NULL) {
+        LPC_SSP0->IMSC = 0;
+        return;
+    }
+    if (LPC_SSP0->RIS & SSP_RORRIS) {
+        Finish(SPIM_STATUS_OVERRUN);
+        return;
+    }
+
+    Drain(pXfer);
+    Chip_SSP_ClearIntPending(LPC_SSP0, SSP_RTIC);
+    if (sRxCount >= pXfer->length) {
+        Finish(SPIM_STATUS_DONE);
+    }
+    else {
+        Fill(pXfer);
+        if (sTxCount >= pXfer->length) {
+            /* Only the last frames are to be received: the TX FIFO will stay at least half empty. */
+            LPC_SSP0->IMSC = SSP_RORIM | SSP_RTIM | SSP_RXIM;
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+void Spim_Init(void)
+{
+    sHead = NULL;
+    LPC_SSP0->IMSC = 0;
+    Chip_SSP_Enable(LPC_SSP0);
+    Chip_SSP_Int_FlushData(LPC_SSP0);
+    NVIC_EnableIRQ(SSP0_IRQn);
+}
+
+void Spim_Submit(SPIM_XFER_T *pXfer)
+{
+    uint32_t primask;
+
+    ASSERT((pXfer != NULL) && (pXfer->length > 0));
+    pXfer->pNext = NULL;
+    pXfer->status = SPIM_STATUS_BUSY;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (sHead == NULL) {
+        sHead = pXfer;
+        sTail = pXfer;
+        Activity(true);
+        Start(pXfer);
+    }
+    else {
+        ASSERT((pXfer != sHead) && (pXfer != sTail));
+        sTail->pNext = pXfer;
+        sTail = pXfer;
+    }
+    __set_PRIMASK(primask);
+}
+
+bool Spim_IsIdle(void)
+{
+    return sHead == NULL;
+}
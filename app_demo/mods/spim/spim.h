@@ -0,0 +1,115 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __SPIM_H_
+#define __SPIM_H_
+
+/** @defgroup MODS_LPC8Nxx_SPIM spim: Asynchronous SPI master module
+ * @ingroup MODS_LPC8Nxx
+ * The asynchronous SPI master module queues SPI transfers and streams them under interrupt, one after the other, each
+ * with its own chip select. Each transfer reports its completion through its own callback.
+ *
+ * The blocking driver API (#Chip_SSP_RWFrames_Blocking and friends) polls the status register once per frame, and
+ * keeps the CPU busy for the whole transfer. Here, the interrupt handler fills the TX FIFO in one burst whenever it is
+ * at least half empty, and empties the RX FIFO whenever it is at least half full - or on the RX timeout for the last
+ * frames. A large transfer - e.g. an external flash page or a display update - costs an interrupt per half a FIFO,
+ * while the main thread sleeps.
+ *
+ * @par Diversity
+ *  This module supports diversity, like a callback to keep the IC out of Deep Sleep while transfers are queued.
+ *  Check @ref MODS_LPC8Nxx_SPIM_DFT for all diversity parameters.
+ *
+ * @par Usage
+ *  - Initialize the SSP driver as master with #Chip_SSP_Init, set the format and the bit rate, configure the pins.
+ *  - Configure the chip select pins as GPIO outputs, driven high.
+ *  - Call #Spim_Init.
+ *  - Fill in an #SPIM_XFER_T and call #Spim_Submit. The transfer is owned by this module until its callback is called.
+ *  .
+ *  A command followed by a data block - e.g. a flash page program - takes two transfers: the first one with
+ *  @c hold set, so that the chip select remains asserted in between.
+ *
+ * @note This mod provides an implementation of the interrupt vector #SSP0_IRQHandler and enables the interrupt
+ *  #SSP0_IRQn.
+ * @note The SSP is stopped in Deep Sleep: a transfer does not proceed in Deep Sleep. See @ref SPIM_ACTIVITY_CB.
+ * @note Do not use the blocking API of the SSP driver while transfers are queued.
+ *
+ * @{
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include "chip.h"
+#include "app_sel.h"
+#include "spim_dft.h"
+
+/* -------------------------------------------------------------------------
+ * Types and defines
+ * ------------------------------------------------------------------------- */
+
+/** Value of #SPIM_XFER_T.csPin for a transfer without chip select. */
+#define SPIM_NO_CS (-1)
+
+/** The outcome of a transfer. */
+typedef enum SPIM_STATUS {
+    SPIM_STATUS_DONE, /**< All frames are sent and received. */
+    SPIM_STATUS_BUSY, /**< The transfer is queued or in progress. */
+    SPIM_STATUS_OVERRUN /**< The RX FIFO overran: the transfer is aborted, and the chip select released. */
+} SPIM_STATUS_T;
+
+typedef struct SPIM_XFER_S SPIM_XFER_T;
+
+/**
+ * Callback function type to report the completion of a transfer.
+ * @param pXfer : The transfer as given to #Spim_Submit.
+ * @note Called under interrupt. The next transfer - if any - is already started. The transfer may be submitted again
+ *  from within the callback.
+ */
+typedef void (*pSpim_Cb_t)(SPIM_XFER_T *pXfer);
+
+/** One SPI transfer, queued by #Spim_Submit. */
+struct SPIM_XFER_S {
+    SPIM_XFER_T *pNext; /**< Private: do not use. */
+    const void *pTx; /**< The frames to send: bytes for frames of up to 8 bits, half words else. @c NULL sends ones. */
+    void *pRx; /**< Where to store the received frames, as for @c pTx. @c NULL discards them. */
+    int length; /**< The number of frames to transfer. At least 1. */
+    int csPin; /**< The PIO0 pin used as active low chip select, or #SPIM_NO_CS. */
+    bool hold; /**< Keep the chip select asserted after the transfer: the next one continues the same command. */
+    pSpim_Cb_t cb; /**< Called on completion. May be @c NULL: poll @c status instead. */
+    uint32_t context; /**< Not used by this mod: free for the caller's own housekeeping. */
+    volatile SPIM_STATUS_T status; /**< Set by this mod. */
+};
+
+/* -------------------------------------------------------------------------
+ * Exported function prototypes
+ * ------------------------------------------------------------------------- */
+
+/**
+ * Initializes the module: enables the SSP and its interrupt.
+ * @pre #Chip_SSP_Init has been called, and the SSP is configured as master.
+ */
+void Spim_Init(void);
+
+/**
+ * Appends a transfer to the queue. If the queue was empty, the transfer starts immediately.
+ * @param pXfer : May not be @c NULL, and may not be queued already.
+ * @note This function may be called from both main and interrupt context.
+ */
+void Spim_Submit(SPIM_XFER_T *pXfer);
+
+/**
+ * @return @c true when no transfer is queued or in progress.
+ */
+bool Spim_IsIdle(void);
+
+#endif /** @} */
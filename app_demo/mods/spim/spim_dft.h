@@ -0,0 +1,42 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __SPIM_DFT_H_
+#define __SPIM_DFT_H_
+
+/** @defgroup MODS_LPC8Nxx_SPIM_DFT Diversity Settings
+ *  @ingroup MODS_LPC8Nxx_SPIM
+ * These 'defines' capture the diversity settings of the module. The displayed values refer to the default settings.
+ * To override the default settings, place the defines with their desired values in the application app_sel.h header
+ * file: the compiler will pick up your defines before parsing this file.
+ * @{
+ */
+
+/**
+ * By default, nothing is notified when the queue becomes busy or idle.
+ * A transfer does not proceed in Deep Sleep, and the SSP interrupt is no Start Logic source: an application entering
+ * Deep Sleep must know when transfers are pending. Set this define to the function to be called with @c true when the
+ * first transfer is queued, and with @c false when the last transfer has completed - e.g. to lock and unlock Deep
+ * Sleep.
+ * @note The function must have the signature: @code void SPIM_ACTIVITY_CB(bool active) @endcode
+ * @note It may be called under interrupt.
+ * @note This must be set to the name of a function, not a pointer to a function: no dereference will be made!
+ */
+#ifndef SPIM_ACTIVITY_CB
+//    #define SPIM_ACTIVITY_CB your_callback
+#endif
+
+/**
+ * @}
+ */
+
+#endif
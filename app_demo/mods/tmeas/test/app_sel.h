@@ -0,0 +1,23 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/* Application settings of the host test and simulation: all output formats and the adaptive policy are built in. */
+
+#ifndef __APP_SEL_H_
+#define __APP_SEL_H_
+
+#define TMEAS_KELVIN 1
+#define TMEAS_CELSIUS 1
+#define TMEAS_FAHRENHEIT 1
+#define TMEAS_ADAPTIVE 1
+
+#endif
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/* Host stand-in for the chip library: only what the tmeas mod uses. The real tsen driver is built on top of a
+ * register block in RAM, which the test fills in. */
+
+#ifndef __CHIP_H_
+#define __CHIP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <assert.h>
+
+#define ASSERT(expression) assert(expression)
+
+#define __I volatile const
+#define __O volatile
+#define __IO volatile
+
+typedef enum SYSCON_PERIPHERAL_POWER {
+    SYSCON_PERIPHERAL_POWER_TSEN
+} SYSCON_PERIPHERAL_POWER_T;
+
+typedef enum CLOCK_PERIPHERAL {
+    CLOCK_PERIPHERAL_TSEN
+} CLOCK_PERIPHERAL_T;
+
+static inline void Chip_SysCon_Peripheral_EnablePower(SYSCON_PERIPHERAL_POWER_T power) { (void)power; }
+static inline void Chip_SysCon_Peripheral_DisablePower(SYSCON_PERIPHERAL_POWER_T power) { (void)power; }
+static inline void Chip_Clock_Peripheral_EnableClock(CLOCK_PERIPHERAL_T clock) { (void)clock; }
+static inline void Chip_Clock_Peripheral_DisableClock(CLOCK_PERIPHERAL_T clock) { (void)clock; }
+
+static inline uint32_t __get_PRIMASK(void) { return 0; }
+static inline void __set_PRIMASK(uint32_t primask) { (void)primask; }
+static inline void __disable_irq(void) { }
+
+#include "tsen_8Nxx.h"
+
+extern LPC_TSEN_T Test_TSen;
+#define LPC_TSEN (&Test_TSen)
+
+#endif
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/*
+ * Host simulation of the adaptive resolution policy of the tmeas mod, on a trace of temperatures.
+ * Each value of the trace is measured with the resolution chosen by the policy, by the real tmeas mod and tsen driver
+ * on top of a sensor model. The sensor returns the value rounded to the step of that resolution
+ * (TMEAS_RESOLUTION_STEP) after the conversion time of that resolution. For the policy, and for each fixed resolution
+ * for comparison, the simulation reports:
+ *  - the charge spent on the conversions: the IC waits for each conversion in Sleep, with the sensor converting;
+ *  - the largest error of a measured value;
+ *  - the number of values that end up on the wrong side of an alarm threshold: a value equal to a threshold raises
+ *    the alarm.
+ *  .
+ * It fails when the policy spends as much as the highest resolution, or misses more alarms than the resolution that
+ * meets the requested accuracy.
+ *
+ * Usage: tmeas_sim <trace> [<alarm low> <alarm high> <accuracy>]
+ *  The trace holds one temperature per line, in deci-degrees Celsius. Lines not starting with a number are ignored.
+ *  The alarm thresholds and the accuracy are in deci-degrees Celsius as well; by default 20, 80 and 3.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "tmeas.h"
+
+/* ------------------------------------------------------------------------- */
+
+#define MAX_SAMPLES 100000
+
+/** Supply current while waiting for a conversion in Sleep, in nA: see POWER_SLEEP_CURRENT in power.h. */
+#define SLEEP_CURRENT 150000
+
+/** Supply current of the sensor while converting, in nA: typical value in the LPC8N04 data sheet. */
+#define TSEN_CURRENT 10000
+
+/** The policies compared: one per fixed resolution, and the adaptive one. */
+#define POLICY_COUNT (TSEN_12BITS - TSEN_7BITS + 2)
+#define POLICY_ADAPTIVE (POLICY_COUNT - 1)
+
+typedef struct RESULT_S {
+    uint64_t charge; /**< In pC. */
+    double maxError; /**< In degrees Celsius. */
+    int missedAlarms;
+    int count[TSEN_12BITS + 1]; /**< The number of conversions per resolution. */
+} RESULT_T;
+
+/* ------------------------------------------------------------------------- */
+
+LPC_TSEN_T Test_TSen;
+
+static int sTrace[MAX_SAMPLES]; /**< In deci-degrees Celsius. */
+static int sCount;
+
+/** The conversion time per resolution, in ms: table 52 of the LPC8N04 user manual UM11074. */
+static const uint32_t sConversionTime[TSEN_12BITS + 1] = {0, 0, 4, 7, 14, 26, 50, 100};
+
+/* ------------------------------------------------------------------------- */
+
+static bool Load(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[256];
+
+    if (f == NULL) {
+        return false;
+    }
+    while ((sCount < MAX_SAMPLES) && (fgets(line, sizeof(line), f) != NULL)) {
+        if ((line[0] == '-') || ((line[0] >= '0') && (line[0] <= '9'))) {
+            sTrace[sCount++] = atoi(line);
+        }
+    }
+    fclose(f);
+    return sCount > 0;
+}
+
+/** Converts deci-degrees Celsius to native units, without rounding. */
+static double ToNative(double deciCelsius)
+{
+    return ((deciCelsius / 10) + 273.15) * 64;
+}
+
+/** Measures @a native with the sensor model: rounded to the step of @a resolution. */
+static int Measure(double native, TSEN_RESOLUTION_T resolution)
+{
+    int step = TMEAS_RESOLUTION_STEP(resolution);
+    int raw = (int)lround(native / step) * step;
+
+    *(volatile uint32_t *)&Test_TSen.DR = (uint32_t)raw & 0xFFFF;
+    *(volatile uint32_t *)&Test_TSen.RIS = 1;
+    return TMeas_Measure(resolution, TMEAS_FORMAT_NATIVE, true, 0);
+}
+
+static void Run(int policy, int low, int high, int accuracy, RESULT_T *pResult)
+{
+    double lowNative = ToNative(low);
+    double highNative = ToNative(high);
+    TSEN_RESOLUTION_T resolution;
+    double native;
+    double error;
+    int measured;
+    int i;
+
+    TMeas_Adaptive_Configure((accuracy * 64) / 10, (int)lround(lowNative), (int)lround(highNative));
+    for (i = 0; i < sCount; i++) {
+        resolution = (policy == POLICY_ADAPTIVE) ? TMeas_Adaptive_GetResolution()
+                                                 : (TSEN_RESOLUTION_T)(TSEN_7BITS + policy);
+        native = ToNative(sTrace[i]);
+        measured = Measure(native, resolution);
+
+        /* ms * nA = pC */
+        pResult->charge += (uint64_t)sConversionTime[resolution] * (SLEEP_CURRENT + TSEN_CURRENT);
+        pResult->count[resolution]++;
+        error = fabs(measured - native) / 64;
+        pResult->maxError = (error > pResult->maxError) ? error : pResult->maxError;
+        if (((native <= lowNative) != (measured <= lowNative))
+                || ((native >= highNative) != (measured >= highNative))) {
+            pResult->missedAlarms++;
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+int main(int argc, char *argv[])
+{
+    RESULT_T results[POLICY_COUNT] = {{0}};
+    int low = 20;
+    int high = 80;
+    int accuracy = 3;
+    int base;
+    int policy;
+    int r;
+
+    if ((argc < 2) || !Load(argv[1])) {
+        printf("Usage: tmeas_sim <trace> [<alarm low> <alarm high> <accuracy>]\n");
+        return 2;
+    }
+    if (argc >= 5) {
+        low = atoi(argv[2]);
+        high = atoi(argv[3]);
+        accuracy = atoi(argv[4]);
+    }
+
+    printf("%d values, alarms at %d and %d, accuracy %d (deci-degrees Celsius)\n", sCount, low, high, accuracy);
+    printf("%-9s %12s %10s %7s   conversions at 7..12 bits\n", "policy", "charge [uC]", "error [C]", "missed");
+    for (policy = 0; policy < POLICY_COUNT; policy++) {
+        Run(policy, low, high, accuracy, &results[policy]);
+        if (policy == POLICY_ADAPTIVE) {
+            printf("%-9s", "adaptive");
+        }
+        else {
+            printf("%2d bits  ", 7 + policy);
+        }
+        printf(" %12.1f %10.3f %7d  ", (double)results[policy].charge / 1000000, results[policy].maxError,
+                results[policy].missedAlarms);
+        for (r = TSEN_7BITS; r <= TSEN_12BITS; r++) {
+            printf(" %5d", results[policy].count[r]);
+        }
+        printf("\n");
+    }
+
+    base = TMeas_ResolutionForAccuracy((accuracy * 64) / 10) - TSEN_7BITS;
+    if ((results[POLICY_ADAPTIVE].charge >= results[TSEN_12BITS - TSEN_7BITS].charge)
+            || (results[POLICY_ADAPTIVE].missedAlarms > results[base].missedAlarms)) {
+        printf("FAIL: the adaptive policy is no better than a fixed resolution\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/*
+ * Host test of the tmeas mod. Every raw 16-bit sensor value is measured once in native format - as it would be
+ * stored in a log - and once in each output format. TMeas_ConvertBatch must turn the stored native values into exactly
+ * the values measured directly, whatever the number of values and also in place.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "tmeas.h"
+
+/* ------------------------------------------------------------------------- */
+
+#define SAMPLE_COUNT 0x10000
+
+#define CHECK(condition) Check((condition), #condition, __LINE__)
+
+/* ------------------------------------------------------------------------- */
+
+LPC_TSEN_T Test_TSen;
+
+static int sFailures;
+
+static int16_t sNative[SAMPLE_COUNT];
+static int16_t sExpected[SAMPLE_COUNT];
+static int16_t sOut[SAMPLE_COUNT];
+
+static const TMEAS_FORMAT_T sFormats[] = {
+    TMEAS_FORMAT_NATIVE, TMEAS_FORMAT_KELVIN, TMEAS_FORMAT_CELSIUS, TMEAS_FORMAT_FAHRENHEIT
+};
+
+/* ------------------------------------------------------------------------- */
+
+static void Check(bool condition, const char *text, int line)
+{
+    if (!condition) {
+        if (sFailures < 20) {
+            printf("FAIL line %d: %s\n", line, text);
+        }
+        sFailures++;
+    }
+}
+
+/** Measures one value synchronously, with the sensor returning @a raw. */
+static int Measure(int raw, TMEAS_FORMAT_T format)
+{
+    *(volatile uint32_t *)&Test_TSen.DR = (uint32_t)raw & 0xFFFF;
+    *(volatile uint32_t *)&Test_TSen.RIS = 1;
+    return TMeas_Measure(TSEN_12BITS, format, true, 0);
+}
+
+/** Returns the number of values in @a out that differ from the expected ones. */
+static int Mismatches(const int16_t *out, const int16_t *expected, int n)
+{
+    int mismatches = 0;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        mismatches += (out[i] != expected[i]);
+    }
+    return mismatches;
+}
+
+static void TestFormat(TMEAS_FORMAT_T format)
+{
+    int i;
+
+    for (i = 0; i < SAMPLE_COUNT; i++) {
+        sExpected[i] = (int16_t)Measure(INT16_MIN + i, format);
+    }
+
+    /* The whole log at once. */
+    memset(sOut, 0, sizeof(sOut));
+    TMeas_ConvertBatch(format, sNative, sOut, SAMPLE_COUNT);
+    CHECK(Mismatches(sOut, sExpected, SAMPLE_COUNT) == 0);
+
+    /* An odd number of values, starting at an odd index. */
+    memset(sOut, 0, sizeof(sOut));
+    TMeas_ConvertBatch(format, sNative + 1, sOut + 1, SAMPLE_COUNT - 2);
+    CHECK(Mismatches(sOut + 1, sExpected + 1, SAMPLE_COUNT - 2) == 0);
+    CHECK((sOut[0] == 0) && (sOut[SAMPLE_COUNT - 1] == 0));
+
+    /* A single value, and none. */
+    memset(sOut, 0, sizeof(sOut));
+    TMeas_ConvertBatch(format, sNative + 7, sOut, 1);
+    TMeas_ConvertBatch(format, sNative, sOut + 1, 0);
+    CHECK((sOut[0] == sExpected[7]) && (sOut[1] == 0));
+
+    /* In place. */
+    memcpy(sOut, sNative, sizeof(sOut));
+    TMeas_ConvertBatch(format, sOut, sOut, SAMPLE_COUNT);
+    CHECK(Mismatches(sOut, sExpected, SAMPLE_COUNT) == 0);
+}
+
+/* ------------------------------------------------------------------------- */
+
+int main(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < SAMPLE_COUNT; i++) {
+        sNative[i] = (int16_t)Measure(INT16_MIN + (int)i, TMEAS_FORMAT_NATIVE);
+    }
+    for (i = 0; i < sizeof(sFormats) / sizeof(sFormats[0]); i++) {
+        TestFormat(sFormats[i]);
+    }
+
+    if (sFailures) {
+        printf("%d failures\n", sFailures);
+        return 1;
+    }
+    printf("tmeas: all tests passed\n");
+    return 0;
+}
@@ -18,11 +18,32 @@
 #include <string.h>
 #include "tmeas.h"
 
+/* -------------------------------------------------------------------------
+ * Private types
+ * ------------------------------------------------------------------------- */
+
+#if defined(TMEAS_CB)
+/** One pending asynchronous measurement request. */
+typedef struct TMEAS_REQUEST_S {
+    TSEN_RESOLUTION_T resolution;
+    TMEAS_FORMAT_T format;
+    uint32_t context;
+} TMEAS_REQUEST_T;
+#endif
+
 /* -------------------------------------------------------------------------
  * Private function prototypes
  * ------------------------------------------------------------------------- */
 
+static void StartConversion(TSEN_RESOLUTION_T resolution, bool synchronous);
+#if defined(TMEAS_CB)
+static bool ScheduleNext(void);
+#endif
+static int Correct(int input);
 static int Convert(TMEAS_FORMAT_T format, int input);
+#if TMEAS_ADAPTIVE
+static void AdaptiveUpdate(int native);
+#endif
 
 /* -------------------------------------------------------------------------
  * Private variables
@@ -30,8 +51,26 @@ static int Convert(TMEAS_FORMAT_T format, int input);
 
 static volatile bool sMeasurementInProgress = false;
 #if defined(TMEAS_CB)
-static volatile TMEAS_FORMAT_T sFormat;
-static volatile uint32_t sContext;
+/** Resolution of the conversion in progress. Only valid while sMeasurementInProgress is @c true. */
+static volatile TSEN_RESOLUTION_T sResolution;
+
+/**
+ * All pending asynchronous requests, oldest first. The request(s) being served by the conversion in progress are
+ * included. Only to be accessed with interrupts disabled.
+ */
+static TMEAS_REQUEST_T sQueue[TMEAS_QUEUE_SIZE];
+static uint32_t sQueueCount = 0;
+#endif
+
+#if TMEAS_ADAPTIVE
+/** Adaptive resolution policy: see TMeas_Adaptive_Configure. */
+static TSEN_RESOLUTION_T sAdaptiveBase = TSEN_12BITS;
+static int sAdaptiveLow = -0x8000;
+static int sAdaptiveHigh = 0x7FFF;
+static int sAdaptiveLast;
+static bool sAdaptiveLastValid = false;
+/** The number of measurements left before the resolution is lowered again. 0 when not raised. */
+static volatile uint32_t sAdaptiveHold = 0;
 #endif
 
 /* -------------------------------------------------------------------------
@@ -41,6 +80,14 @@ static volatile uint32_t sContext;
 #if defined(TMEAS_CB)
 void TSEN_IRQHandler(void)
 {
+    TMEAS_REQUEST_T served[TMEAS_QUEUE_SIZE];
+    uint32_t servedCount = 0;
+    TSEN_RESOLUTION_T resolution = sResolution;
+    bool next = false;
+    uint32_t primask;
+    uint32_t n;
+    uint32_t i;
+
     /* If interrupt is reached, we can safely deduct that the RDY bit was set and therefore the
      * TSEN_STATUS_MEASUREMENT_SUCCESS status bit is set. The remaining (RANGE) status bits, even when set, should not
      * invalidate the temperature measurement,
@@ -48,23 +95,80 @@ void TSEN_IRQHandler(void)
      */
     /* Measurement ready. Read the data (thereby also clearing the interrupt). */
     int value = Chip_TSen_GetValue(LPC_TSEN);
-    int output = Convert(sFormat, value);
     NVIC_DisableIRQ(TSEN_IRQn);
     Chip_TSen_DeInit(LPC_TSEN);
-    {
+#if TMEAS_ADAPTIVE
+    AdaptiveUpdate(Correct(value));
+#endif
+
+    /* Take out all requests for this resolution: they are all served by this one conversion.
+     * Keep the order of the remaining ones, and start a conversion for the oldest of them. */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    for (i = 0, n = 0; i < sQueueCount; i++) {
+        if (sQueue[i].resolution == resolution) {
+            served[servedCount++] = sQueue[i];
+        }
+        else {
+            sQueue[n++] = sQueue[i];
+        }
+    }
+    sQueueCount = n;
+    next = ScheduleNext();
+    __set_PRIMASK(primask);
+
+    if (next) {
+        StartConversion(sResolution, false);
+    }
+
+    /* The callback may issue new requests: these are simply queued, or start a new conversion. */
+    for (i = 0; i < servedCount; i++) {
         extern void TMEAS_CB(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format, int value, uint32_t context);
-        TMEAS_CB(Chip_TSen_GetResolution(LPC_TSEN), sFormat, output, sContext);
+        TMEAS_CB(resolution, served[i].format, Convert(served[i].format, value), served[i].context);
+    }
+}
+#endif
+
+/* ------------------------------------------------------------------------- */
+
+#if defined(TMEAS_CB)
+/**
+ * Decides what to do after a conversion has completed.
+ * @return @c true when a conversion must be started for the oldest pending request, at resolution sResolution.
+ * @pre Interrupts are disabled.
+ */
+static bool ScheduleNext(void)
+{
+    if (sQueueCount > 0) {
+        sResolution = sQueue[0].resolution;
+        return true;
     }
     sMeasurementInProgress = false;
+    return false;
 }
 #endif
 
 /* ------------------------------------------------------------------------- */
 
-static int Convert(TMEAS_FORMAT_T format, int input)
+static void StartConversion(TSEN_RESOLUTION_T resolution, bool synchronous)
 {
-    int output;
+    Chip_TSen_Init(LPC_TSEN);
+    Chip_TSen_SetResolution(LPC_TSEN, resolution);
+#if defined(TMEAS_CB)
+    if (!synchronous) {
+        Chip_TSen_Int_SetEnabledMask(LPC_TSEN, TSEN_INT_MEASUREMENT_RDY);
+        NVIC_EnableIRQ(TSEN_IRQn);
+    }
+#else
+    (void)synchronous;
+#endif
+    Chip_TSen_Start(LPC_TSEN);
+}
+
+/* ------------------------------------------------------------------------- */
 
+static int Correct(int input)
+{
     /* Temperature sensor correction is applied in the Native value here.
      * Regardless of the sample, a correction needs to be applied to fix a deviation with the sensor.
      * For a value C in degrees Celsius:
@@ -80,7 +184,16 @@ static int Convert(TMEAS_FORMAT_T format, int input)
 #if TMEAS_SENSOR_CORRECTION
     input = input - (input/128) + 137;
 #endif
+    return input;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static int Convert(TMEAS_FORMAT_T format, int input)
+{
+    int output;
 
+    input = Correct(input);
     switch (format) {
 #if TMEAS_KELVIN
         case TMEAS_FORMAT_KELVIN:
@@ -105,56 +218,194 @@ static int Convert(TMEAS_FORMAT_T format, int input)
     return output;
 }
 
+/* ------------------------------------------------------------------------- */
+
+#if TMEAS_ADAPTIVE
+/**
+ * Feeds a completed measurement to the adaptive resolution policy.
+ * @param native : The corrected measurement, in native format.
+ */
+static void AdaptiveUpdate(int native)
+{
+    int diff = native - sAdaptiveLast;
+    bool raise = ((native > sAdaptiveLow - TMEAS_ADAPTIVE_MARGIN) && (native < sAdaptiveLow + TMEAS_ADAPTIVE_MARGIN))
+            || ((native > sAdaptiveHigh - TMEAS_ADAPTIVE_MARGIN) && (native < sAdaptiveHigh + TMEAS_ADAPTIVE_MARGIN))
+            || (sAdaptiveLastValid && ((diff > TMEAS_ADAPTIVE_RATE) || (diff < -TMEAS_ADAPTIVE_RATE)));
+
+    if (raise) {
+        sAdaptiveHold = TMEAS_ADAPTIVE_HOLD;
+    }
+    else if (sAdaptiveHold > 0) {
+        sAdaptiveHold--;
+    }
+    sAdaptiveLast = native;
+    sAdaptiveLastValid = true;
+}
+#endif
+
 /* -------------------------------------------------------------------------
  * Exported functions
  * ------------------------------------------------------------------------- */
 // ¶ȴ
 int TMeas_Measure(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format, bool synchronous, uint32_t context)
 {
-#if !defined(TMEAS_CB)
+    int output = TMEAS_ERROR;
+    bool start = false;
+    uint32_t primask;
+
+#if defined(TMEAS_CB)
+    if (!synchronous) {
+        primask = __get_PRIMASK();
+        __disable_irq();
+        if (sQueueCount < TMEAS_QUEUE_SIZE) {
+            sQueue[sQueueCount].resolution = resolution;
+            sQueue[sQueueCount].format = format;
+            sQueue[sQueueCount].context = context;
+            sQueueCount++;
+            if (!sMeasurementInProgress) {
+                sMeasurementInProgress = true;
+                sResolution = resolution;
+                start = true;
+            }
+            /* Else: served by the conversion in progress when the resolution matches, or queued for a later one. */
+            output = 0;
+        }
+        __set_PRIMASK(primask);
+
+        if (start) {
+            StartConversion(resolution, false);
+        }
+        return output;
+    }
+#else
     /* gracefully do nothing and avoid compiler warnings */
     (void)synchronous;
     (void)context;
 #endif
-    int output = TMEAS_ERROR;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
     if (!sMeasurementInProgress) {
         sMeasurementInProgress = true;
+        start = true;
+    }
+    __set_PRIMASK(primask);
 
-        Chip_TSen_Init(LPC_TSEN);
-        Chip_TSen_SetResolution(LPC_TSEN, resolution);
-#if defined(TMEAS_CB)
-        if (!synchronous) {
-            sFormat = format;
-            sContext = context;
-            Chip_TSen_Int_SetEnabledMask(LPC_TSEN, TSEN_INT_MEASUREMENT_RDY);
-            NVIC_EnableIRQ(TSEN_IRQn);
+    if (start) {
+        StartConversion(resolution, true);
+        while (!(Chip_TSen_ReadStatus(LPC_TSEN, NULL) & TSEN_STATUS_MEASUREMENT_DONE)) {
+            ; /* wait */
         }
+        /* The remaining (RANGE) status bits, even when set, should not invalidate the temperature measurement,
+         * hence we can always assume that, at this moment, the value present in the TSEN Value register is always valid. */
+        /* Measurement ready. Read the data (thereby also clearing the DONE status bit). */
+        output = Chip_TSen_GetValue(LPC_TSEN);
+        Chip_TSen_DeInit(LPC_TSEN);
+#if TMEAS_ADAPTIVE
+        AdaptiveUpdate(Correct(output));
 #endif
-        output = TMEAS_ERROR;
-
-        Chip_TSen_Start(LPC_TSEN);
-#if defined(TMEAS_CB)
-        if (synchronous)
-#endif
-        {
-            while (!(Chip_TSen_ReadStatus(LPC_TSEN, NULL) & TSEN_STATUS_MEASUREMENT_DONE)) {
-                ; /* wait */
-            }
-            /* The remaining (RANGE) status bits, even when set, should not invalidate the temperature measurement,
-             * hence we can always assume that, at this moment, the value present in the TSEN Value register is always valid. */
-            /* Measurement ready. Read the data (thereby also clearing the DONE status bit). */
-            output = Convert(format, Chip_TSen_GetValue(LPC_TSEN));
-            NVIC_DisableIRQ(TSEN_IRQn);
-            Chip_TSen_DeInit(LPC_TSEN);
-            sMeasurementInProgress = false;
-        }
+        output = Convert(format, output);
 #if defined(TMEAS_CB)
-        else {
-            output = 0;
-            /* sMeasurementInProgress is set to false in TSEN_IRQHandler */
+        /* Asynchronous requests may have been queued meanwhile (from interrupt context). */
+        primask = __get_PRIMASK();
+        __disable_irq();
+        start = ScheduleNext();
+        __set_PRIMASK(primask);
+        if (start) {
+            StartConversion(sResolution, false);
         }
+#else
+        sMeasurementInProgress = false;
 #endif
     }
 
     return output;
 }
+
+/* ------------------------------------------------------------------------- */
+
+void TMeas_ConvertBatch(TMEAS_FORMAT_T format, const int16_t *in, int16_t *out, uint32_t n)
+{
+    int (*convert)(int native, int multiplier);
+    int a;
+    int b;
+
+    /* Resolve the format once for the whole batch instead of once per sample. */
+    switch (format) {
+#if TMEAS_KELVIN
+        case TMEAS_FORMAT_KELVIN:
+            convert = Chip_TSen_NativeToKelvin;
+            break;
+#endif
+#if TMEAS_CELSIUS
+        case TMEAS_FORMAT_CELSIUS:
+            convert = Chip_TSen_NativeToCelsius;
+            break;
+#endif
+#if TMEAS_FAHRENHEIT
+        case TMEAS_FORMAT_FAHRENHEIT:
+            convert = Chip_TSen_NativeToFahrenheit;
+            break;
+#endif
+        default:
+        case TMEAS_FORMAT_NATIVE:
+            convert = NULL;
+            break;
+    }
+
+    /* The stored native values have been corrected already by TMeas_Measure: only convert them. */
+    if (convert == NULL) {
+        memmove(out, in, n * sizeof(int16_t));
+        return;
+    }
+
+    /* Two samples per iteration: halves the loop overhead, and lets the compiler keep both samples in registers. */
+    for (; n >= 2; n -= 2) {
+        a = convert(in[0], 10);
+        b = convert(in[1], 10);
+        out[0] = (int16_t)a;
+        out[1] = (int16_t)b;
+        in += 2;
+        out += 2;
+    }
+    if (n) {
+        *out = (int16_t)convert(*in, 10);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+TSEN_RESOLUTION_T TMeas_ResolutionForAccuracy(int accuracy)
+{
+    TSEN_RESOLUTION_T resolution;
+
+    for (resolution = TSEN_7BITS; resolution < TSEN_12BITS; resolution++) {
+        if (TMEAS_RESOLUTION_STEP(resolution) <= accuracy) {
+            break;
+        }
+    }
+    return resolution;
+}
+
+#if TMEAS_ADAPTIVE
+/* ------------------------------------------------------------------------- */
+
+void TMeas_Adaptive_Configure(int accuracy, int alarmLow, int alarmHigh)
+{
+    sAdaptiveBase = TMeas_ResolutionForAccuracy(accuracy);
+    sAdaptiveLow = alarmLow;
+    sAdaptiveHigh = alarmHigh;
+    sAdaptiveLastValid = false;
+    sAdaptiveHold = 0;
+}
+
+/* ------------------------------------------------------------------------- */
+
+TSEN_RESOLUTION_T TMeas_Adaptive_GetResolution(void)
+{
+    if ((sAdaptiveHold > 0) && (TMEAS_ADAPTIVE_RAISED_RESOLUTION > sAdaptiveBase)) {
+        return TMEAS_ADAPTIVE_RAISED_RESOLUTION;
+    }
+    return sAdaptiveBase;
+}
+#endif
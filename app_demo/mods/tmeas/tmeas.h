@@ -51,7 +51,8 @@
  * ------------------------------------------------------------------------- */
 
 /**
- * Returned value of #TMeas_Measure to indicate a measurement is already in progress.
+ * Returned value of #TMeas_Measure to indicate a measurement is already in progress (synchronous requests), or the
+ * request queue is full (asynchronous requests).
  */
 #define TMEAS_ERROR (-1)
 
@@ -88,19 +89,69 @@ typedef void (*pTMeas_Cb_t)(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format,
  *   - If @c true the function is synchronous, and will only return once the measurement is complete.
  *   - Else the function is asynchronous; it will return immediately, and once the temperature sensor has completed
  *     its measurement, the temperature is reported via the callback function @c TMEAS_CB.
+ *     When a measurement is already in progress, the request is queued: see @ref TMEAS_QUEUE_SIZE. Requests for the
+ *     same resolution share a single conversion, each reported with its own format and context.
  *   .
  * @param context : Context information for the caller. You can fill in any value here: it is not used by this mod,
  *   only stored and sent back in a later call to @c TMEAS_CB. Use this as an aid for your own housekeeping, or
  *   disregard this argument: it doesn't impede the mod's working in any way.
  * @return
- *   - If no measurement could be taken (TSEN HW block in use), #TMEAS_ERROR is returned.
+ *   - If no measurement could be taken (TSEN HW block in use for a synchronous request, or request queue full for an
+ *     asynchronous request), #TMEAS_ERROR is returned.
  *   - Else, if @c synchronous equals @c true, the measured temperature.
  *   - Else, @c 0 to indicate a measurement is ongoing and the callback will be called when the measurement is ready.
  *   .
- * @note @c TMEAS_CB will be called under interrupt.
- * @note This function is not re-entrant.
+ * @note @c TMEAS_CB will be called under interrupt. It is allowed to call this function from within @c TMEAS_CB.
+ * @note This function may be called from both main and interrupt context.
  * @see pTMeas_Cb_t
  */
 int TMeas_Measure(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format, bool synchronous, uint32_t context);
 
+/**
+ * Convert a series of stored native temperature values, as returned by #TMeas_Measure for the format
+ * #TMEAS_FORMAT_NATIVE, to the given format.
+ * The result is identical to converting each sample separately, but the format is only evaluated once for the
+ * whole series, and the samples are processed in pairs. Native values are copied as they are.
+ * @param format : The required output format.
+ * @param in : Pointer to @c n native temperature values. Must not be @c NULL when @c n is not 0.
+ * @param out : Pointer to an array of at least @c n elements, where the converted values are stored. May be equal to
+ *  @c in to convert in place.
+ * @param n : The number of values to convert.
+ * @note The input values are expected to be corrected already, as #TMeas_Measure does when
+ *  @ref TMEAS_SENSOR_CORRECTION is enabled: no correction is applied again.
+ */
+void TMeas_ConvertBatch(TMEAS_FORMAT_T format, const int16_t *in, int16_t *out, uint32_t n);
+
+/**
+ * Determines the lowest resolution which has a quantisation step not larger than the given accuracy.
+ * A lower resolution takes less time, and thus less energy, to make a measurement.
+ * @param accuracy : The required accuracy, in native units (1/64 Kelvin).
+ * @return The lowest resolution meeting @c accuracy, or #TSEN_12BITS if none does.
+ * @see TMEAS_RESOLUTION_STEP
+ */
+TSEN_RESOLUTION_T TMeas_ResolutionForAccuracy(int accuracy);
+
+#if TMEAS_ADAPTIVE
+/**
+ * Configures the adaptive resolution policy.
+ * The policy uses the lowest resolution meeting @c accuracy, and raises the resolution to
+ * #TMEAS_ADAPTIVE_RAISED_RESOLUTION when a measurement comes within #TMEAS_ADAPTIVE_MARGIN of an alarm threshold, or
+ * differs more than #TMEAS_ADAPTIVE_RATE from the previous measurement. After #TMEAS_ADAPTIVE_HOLD measurements without
+ * such a reason, the resolution is lowered again.
+ * Each completed measurement - synchronous or asynchronous, in any resolution and format - is taken into account.
+ * @param accuracy : The required accuracy, in native units (1/64 Kelvin). See #TMeas_ResolutionForAccuracy.
+ * @param alarmLow : The low alarm threshold, in native format. Use #Chip_TSen_CelsiusToNative to convert.
+ * @param alarmHigh : The high alarm threshold, in native format.
+ */
+void TMeas_Adaptive_Configure(int accuracy, int alarmLow, int alarmHigh);
+
+/**
+ * Retrieves the resolution to use for the next measurement, as decided by the adaptive resolution policy.
+ * @return The resolution to pass to #TMeas_Measure.
+ * @note The resolution used is reported back for each measurement in the @c resolution argument of @c TMEAS_CB, and
+ *  can be stored together with the measured value.
+ */
+TSEN_RESOLUTION_T TMeas_Adaptive_GetResolution(void);
+#endif
+
 #endif /** @} */
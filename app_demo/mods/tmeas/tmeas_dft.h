@@ -56,6 +56,8 @@
  * Set this define to 0 to disable the temperature sensor correction (enabled by default).
  * If, for your IC revision, the correction is applied straight in the TSEN calibration parameters, it must be set to 0.
  * Otherwise, it must be left at default value (1).
+ * @note The @ref MODS_LPC8Nxx_CALIB "calib" mod applies a per-device correction in the TSEN calibration parameters:
+ *  when using it, set this define to 0.
  */
 #if (!defined(TMEAS_SENSOR_CORRECTION))
     #define TMEAS_SENSOR_CORRECTION 1
@@ -73,6 +75,69 @@
 //    #define TMEAS_CB your_callback
 #endif
 
+/**
+ * The maximum number of asynchronous measurement requests that can be pending at the same time.
+ * Requests made while a measurement is in progress are queued instead of being refused. All queued requests for the
+ * same resolution are served by one and the same conversion; requests for a different resolution are served in
+ * order of arrival.
+ * @note Only used when @ref TMEAS_CB is defined. Must be at least 1.
+ */
+#if (!defined(TMEAS_QUEUE_SIZE))
+    #define TMEAS_QUEUE_SIZE 4
+#endif
+
+/**
+ * The quantisation step, in native units (1/64 Kelvin), of a measurement taken with the given resolution.
+ * Used by #TMeas_ResolutionForAccuracy to select the lowest - fastest and cheapest - resolution that meets an accuracy.
+ * By default, each bit less than 12 doubles the step, starting from 1 native unit at 12 bits.
+ */
+#if (!defined(TMEAS_RESOLUTION_STEP))
+    #define TMEAS_RESOLUTION_STEP(resolution) (1 << (TSEN_12BITS - (resolution)))
+#endif
+
+/**
+ * Set this define to 1 to enable the adaptive resolution policy. See #TMeas_Adaptive_Configure and
+ * #TMeas_Adaptive_GetResolution.
+ */
+#if (!defined(TMEAS_ADAPTIVE))
+    #define TMEAS_ADAPTIVE 0
+#endif
+
+/**
+ * The resolution used by the adaptive resolution policy while raised.
+ * @note Only used when @ref TMEAS_ADAPTIVE is set to 1.
+ */
+#if (!defined(TMEAS_ADAPTIVE_RAISED_RESOLUTION))
+    #define TMEAS_ADAPTIVE_RAISED_RESOLUTION TSEN_12BITS
+#endif
+
+/**
+ * The adaptive resolution policy raises the resolution when a measurement is closer than this distance to one of the
+ * alarm thresholds. In native units (1/64 Kelvin). The default value corresponds to 1 degree.
+ * @note Only used when @ref TMEAS_ADAPTIVE is set to 1.
+ */
+#if (!defined(TMEAS_ADAPTIVE_MARGIN))
+    #define TMEAS_ADAPTIVE_MARGIN 64
+#endif
+
+/**
+ * The adaptive resolution policy raises the resolution when two consecutive measurements differ more than this value.
+ * In native units (1/64 Kelvin). The default value corresponds to 0.5 degree.
+ * @note Only used when @ref TMEAS_ADAPTIVE is set to 1.
+ */
+#if (!defined(TMEAS_ADAPTIVE_RATE))
+    #define TMEAS_ADAPTIVE_RATE 32
+#endif
+
+/**
+ * The number of consecutive measurements without a reason to raise the resolution, before the adaptive resolution
+ * policy lowers it again.
+ * @note Only used when @ref TMEAS_ADAPTIVE is set to 1.
+ */
+#if (!defined(TMEAS_ADAPTIVE_HOLD))
+    #define TMEAS_ADAPTIVE_HOLD 4
+#endif
+
 /**
  * @}
  */
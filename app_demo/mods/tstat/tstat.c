@@ -0,0 +1,248 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include <string.h>
+#include "tstat.h"
+#include "ndeft2t/ndeft2t.h"
+
+/* -------------------------------------------------------------------------
+ * Private types and defines
+ * ------------------------------------------------------------------------- */
+
+/**
+ * Marks a valid record in EEPROM. The number of bins is part of it, so that a change in layout invalidates it. The
+ * upper byte changes with the layout of the record itself.
+ */
+#define TSTAT_MAGIC (0x5500 | (TSTAT_HISTOGRAM_BINS & 0xFF))
+
+/**
+ * The number of fractional bits of the mean kept internally. More than #TSTAT_FRACTION_BITS, to limit the drift of the
+ * mean due to rounding when the number of values grows large.
+ */
+#define MEAN_FRACTION_BITS 12
+
+/** The complete state of the module, as kept in RAM and stored in EEPROM. */
+typedef struct TSTAT_STATE_S {
+    uint16_t magic; /**< #TSTAT_MAGIC */
+    uint16_t checksum; /**< Makes the 16-bit sum of all half words of the record equal to 0xFFFF. */
+    uint32_t count;
+    int16_t min;
+    int16_t max;
+    int32_t mean; /**< With #MEAN_FRACTION_BITS fractional bits. */
+    uint64_t m2; /**< Welford's sum of squared differences from the mean, with #TSTAT_FRACTION_BITS fractional bits. */
+    uint32_t timeBelow;
+    uint32_t timeAbove;
+    uint32_t countBelow;
+    uint32_t countAbove;
+    uint16_t histogram[TSTAT_HISTOGRAM_BINS];
+    uint8_t minResolution;
+    uint8_t maxResolution;
+} TSTAT_STATE_T;
+
+/* -------------------------------------------------------------------------
+ * Private function prototypes
+ * ------------------------------------------------------------------------- */
+
+static uint16_t Checksum(const TSTAT_STATE_T *pState);
+static void Copy(TSTAT_STATE_T *pState);
+
+/* -------------------------------------------------------------------------
+ * Private variables
+ * ------------------------------------------------------------------------- */
+
+static TSTAT_STATE_T sState;
+
+/** Set when sState has changed since it was last stored in EEPROM. */
+static volatile bool sDirty;
+
+/* -------------------------------------------------------------------------
+ * Private functions
+ * ------------------------------------------------------------------------- */
+
+static uint16_t Checksum(const TSTAT_STATE_T *pState)
+{
+    const uint16_t *p = (const uint16_t *)pState;
+    uint32_t sum = 0;
+    uint32_t i;
+
+    for (i = 0; i < sizeof(TSTAT_STATE_T) / sizeof(uint16_t); i++) {
+        sum += p[i];
+    }
+    sum -= pState->checksum;
+    sum = (sum & 0xFFFF) + (sum >> 16);
+    sum = (sum & 0xFFFF) + (sum >> 16);
+    return (uint16_t)~sum;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/** Takes a consistent snapshot of sState: TStat_Add may be called under interrupt. */
+static void Copy(TSTAT_STATE_T *pState)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *pState = sState;
+    __set_PRIMASK(primask);
+}
+
+/* -------------------------------------------------------------------------
+ * Exported functions
+ * ------------------------------------------------------------------------- */
+
+void TStat_Init(void)
+{
+    TSTAT_STATE_T state;
+
+    Chip_EEPROM_Read(LPC_EEPROM, TSTAT_EEPROM_OFFSET, &state, sizeof(TSTAT_STATE_T));
+    if ((state.magic == TSTAT_MAGIC) && (state.checksum == Checksum(&state))) {
+        sState = state;
+        sDirty = false;
+    }
+    else {
+        TStat_Reset();
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+void TStat_Reset(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    memset(&sState, 0, sizeof(TSTAT_STATE_T));
+    sState.magic = TSTAT_MAGIC;
+    sDirty = true;
+    __set_PRIMASK(primask);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void TStat_Add(int value, uint32_t duration, TSEN_RESOLUTION_T resolution)
+{
+    int32_t x = (int32_t)value << MEAN_FRACTION_BITS;
+    int32_t delta;
+    int32_t step;
+    int bin;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (sState.count == 0) {
+        sState.min = (int16_t)value;
+        sState.max = (int16_t)value;
+        sState.minResolution = (uint8_t)resolution;
+        sState.maxResolution = (uint8_t)resolution;
+    }
+    else if (value < sState.min) {
+        sState.min = (int16_t)value;
+        sState.minResolution = (uint8_t)resolution;
+    }
+    else if (value > sState.max) {
+        sState.max = (int16_t)value;
+        sState.maxResolution = (uint8_t)resolution;
+    }
+
+    /* Welford: mean' = mean + (x - mean) / n, and M2' = M2 + (x - mean) * (x - mean').
+     * With a rounded division, mean' never passes x: both differences have the same sign and their product is never
+     * negative. This is the only division per sample; the variance itself is only derived when asked for. */
+    sState.count++;
+    delta = x - sState.mean;
+    step = (int32_t)((delta < 0 ? (delta - (int32_t)(sState.count / 2)) : (delta + (int32_t)(sState.count / 2)))
+            / (int32_t)sState.count);
+    sState.mean += step;
+    sState.m2 += ((uint64_t)((int64_t)delta * (x - sState.mean))) >> ((2 * MEAN_FRACTION_BITS) - TSTAT_FRACTION_BITS);
+
+    if (value < TSTAT_LOW_THRESHOLD) {
+        sState.timeBelow += duration;
+        sState.countBelow++;
+    }
+    else if (value > TSTAT_HIGH_THRESHOLD) {
+        sState.timeAbove += duration;
+        sState.countAbove++;
+    }
+
+    /* Bin 0 holds everything below TSTAT_HISTOGRAM_MIN, the last bin everything above the histogram range. */
+    bin = value - (TSTAT_HISTOGRAM_MIN);
+    bin = (bin < 0) ? 0 : 1 + (bin >> TSTAT_HISTOGRAM_SHIFT);
+    if (bin > TSTAT_HISTOGRAM_BINS - 1) {
+        bin = TSTAT_HISTOGRAM_BINS - 1;
+    }
+    if (sState.histogram[bin] < 0xFFFF) {
+        sState.histogram[bin]++;
+    }
+
+    sDirty = true;
+    __set_PRIMASK(primask);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void TStat_GetSummary(TSTAT_SUMMARY_T *pSummary)
+{
+    TSTAT_STATE_T state;
+    uint64_t variance = 0;
+
+    ASSERT(pSummary != NULL);
+    Copy(&state);
+
+    if (state.count > 1) {
+        variance = state.m2 / (state.count - 1);
+    }
+    pSummary->count = state.count;
+    pSummary->min = state.min;
+    pSummary->max = state.max;
+    pSummary->mean = (state.mean + (1 << (MEAN_FRACTION_BITS - TSTAT_FRACTION_BITS - 1)))
+            >> (MEAN_FRACTION_BITS - TSTAT_FRACTION_BITS);
+    pSummary->variance = (variance > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32_t)variance;
+    pSummary->timeBelow = state.timeBelow;
+    pSummary->timeAbove = state.timeAbove;
+    pSummary->countBelow = state.countBelow;
+    pSummary->countAbove = state.countAbove;
+    pSummary->minResolution = state.minResolution;
+    pSummary->maxResolution = state.maxResolution;
+    memcpy(pSummary->histogram, state.histogram, sizeof(pSummary->histogram));
+}
+
+/* ------------------------------------------------------------------------- */
+
+void TStat_Save(bool wait)
+{
+    TSTAT_STATE_T state;
+
+    if (sDirty) {
+        sDirty = false;
+        Copy(&state);
+        state.checksum = Checksum(&state);
+        Chip_EEPROM_Write(LPC_EEPROM, TSTAT_EEPROM_OFFSET, &state, sizeof(TSTAT_STATE_T));
+        Chip_EEPROM_Flush(LPC_EEPROM, wait);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+bool TStat_CreateRecord(void *pInstance)
+{
+    NDEFT2T_CREATE_RECORD_INFO_T recordInfo = {.pString = (uint8_t *)TSTAT_MIME_TYPE, .shortRecord = true};
+    TSTAT_SUMMARY_T summary;
+
+    TStat_GetSummary(&summary);
+    if (NDEFT2T_CreateMimeRecord(pInstance, &recordInfo)
+            && NDEFT2T_WriteRecordPayload(pInstance, &summary, TSTAT_SUMMARY_SIZE)) {
+        NDEFT2T_CommitRecord(pInstance);
+        return true;
+    }
+    return false;
+}
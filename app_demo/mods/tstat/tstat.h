@@ -0,0 +1,136 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __TSTAT_H_
+#define __TSTAT_H_
+
+/** @defgroup MODS_LPC8Nxx_TSTAT tstat: Temperature statistics module
+ * @ingroup MODS_LPC8Nxx
+ * The temperature statistics module keeps a running summary of all temperature values it is given, so that a reader
+ * does not need to retrieve all individual samples to learn about them.
+ * The summary consists of:
+ *  - the number of samples, the minimum and the maximum value;
+ *  - the running mean and variance, calculated with Welford's online algorithm in fixed point;
+ *  - a histogram with a configurable number of bins;
+ *  - the time spent below and above a configurable allowed temperature range.
+ *  .
+ * Every new sample updates the summary in constant time, without storing the sample itself.
+ *
+ * @par Diversity
+ *  This module supports diversity, like the range limits and the histogram layout.
+ *  Check @ref MODS_LPC8Nxx_TSTAT_DFT for all diversity parameters.
+ *
+ * @par Usage
+ *  - Call #TStat_Init once after start up, to restore the statistics saved earlier.
+ *  - Feed each measured value to #TStat_Add, typically from within the @c TMEAS_CB callback of the
+ *    @ref MODS_LPC8Nxx_TMEAS "tmeas" module. All values must use the same unit, e.g. deci-degrees Celsius.
+ *  - Call #TStat_Save regularly, and before going to a power mode in which RAM content is lost.
+ *  - Add the summary to an NDEF message with #TStat_CreateRecord: a phone tap then returns the summary in one short
+ *    read.
+ *  .
+ *
+ * @note This module accesses the EEPROM using the EEPROM driver: the caller must make sure the EEPROM driver is
+ *  initialized (#Chip_EEPROM_Init) before calling #TStat_Init or #TStat_Save.
+ *
+ * @{
+ */
+
+/* -------------------------------------------------------------------------
+ * Include files
+ * ------------------------------------------------------------------------- */
+
+#include "chip.h"
+#include "app_sel.h"
+#include "tstat_dft.h"
+
+/* -------------------------------------------------------------------------
+ * Types and defines
+ * ------------------------------------------------------------------------- */
+
+/** The number of bits of the fractional part of #TSTAT_SUMMARY_T.mean and #TSTAT_SUMMARY_T.variance. */
+#define TSTAT_FRACTION_BITS 8
+
+/** The size in bytes of the payload of the NDEF record created by #TStat_CreateRecord. */
+#define TSTAT_SUMMARY_SIZE (34 + (2 * TSTAT_HISTOGRAM_BINS))
+
+/**
+ * Summary of all values given to #TStat_Add since the last call to #TStat_Reset.
+ * The first #TSTAT_SUMMARY_SIZE bytes are also the payload of the NDEF record, with all fields in little endian byte
+ * order and without any padding.
+ */
+typedef struct TSTAT_SUMMARY_S {
+    uint32_t count; /*!< The number of values. When 0, all other fields are to be ignored. */
+    int16_t min; /*!< The lowest value. */
+    int16_t max; /*!< The highest value. */
+    int32_t mean; /*!< The mean value, with #TSTAT_FRACTION_BITS fractional bits. */
+    uint32_t variance; /*!< The sample variance, with #TSTAT_FRACTION_BITS fractional bits, saturated to 0xFFFFFFFF. */
+    uint32_t timeBelow; /*!< The accumulated time spent below #TSTAT_LOW_THRESHOLD. */
+    uint32_t timeAbove; /*!< The accumulated time spent above #TSTAT_HIGH_THRESHOLD. */
+    uint32_t countBelow; /*!< The number of values below #TSTAT_LOW_THRESHOLD. */
+    uint32_t countAbove; /*!< The number of values above #TSTAT_HIGH_THRESHOLD. */
+    uint8_t minResolution; /*!< The resolution #TSTAT_SUMMARY_T.min was measured with, as given to #TStat_Add. */
+    uint8_t maxResolution; /*!< The resolution #TSTAT_SUMMARY_T.max was measured with, as given to #TStat_Add. */
+    uint16_t histogram[TSTAT_HISTOGRAM_BINS]; /*!< Number of values per bin, saturated to 0xFFFF. */
+} TSTAT_SUMMARY_T;
+
+/* -------------------------------------------------------------------------
+ * Exported function prototypes
+ * ------------------------------------------------------------------------- */
+
+/**
+ * Initializes the module, and restores the statistics last saved with #TStat_Save.
+ * If no valid statistics are found in EEPROM, the statistics are reset.
+ * @pre The EEPROM driver is initialized.
+ */
+void TStat_Init(void);
+
+/**
+ * Forgets all values given so far. The EEPROM copy is not changed until the next call to #TStat_Save.
+ */
+void TStat_Reset(void);
+
+/**
+ * Updates the statistics with one new value.
+ * @param value : The new temperature value.
+ * @param duration : The time this value is representative for, typically the time elapsed since the previous
+ *  measurement. Use a fixed unit, e.g. seconds. This is only used for #TSTAT_SUMMARY_T.timeBelow and
+ *  #TSTAT_SUMMARY_T.timeAbove.
+ * @param resolution : The resolution the value was measured with, as reported by the @c TMEAS_CB callback. It is kept
+ *  with the minimum and the maximum value: see #TSTAT_SUMMARY_T.minResolution and #TSTAT_SUMMARY_T.maxResolution.
+ * @note May be called under interrupt.
+ */
+void TStat_Add(int value, uint32_t duration, TSEN_RESOLUTION_T resolution);
+
+/**
+ * Retrieves a summary of the statistics.
+ * @param pSummary : May not be @c NULL. Will be filled in.
+ */
+void TStat_GetSummary(TSTAT_SUMMARY_T *pSummary);
+
+/**
+ * Stores the statistics in EEPROM, at #TSTAT_EEPROM_OFFSET. Nothing is written if nothing changed since the previous
+ * save.
+ * @param wait : Indicates if the function needs to busy wait till the EEPROM has been programmed.
+ * @pre The EEPROM driver is initialized.
+ */
+void TStat_Save(bool wait);
+
+/**
+ * Adds a MIME record with a #TSTAT_SUMMARY_T payload to the NDEF message being created.
+ * @param pInstance : The NDEFT2T instance buffer, as given to #NDEFT2T_CreateMessage.
+ * @return @c true when the record was added, @c false if there was not enough space in the message.
+ * @pre #NDEFT2T_CreateMessage has been called.
+ * @post Call #NDEFT2T_CommitMessage when all records have been added.
+ */
+bool TStat_CreateRecord(void *pInstance);
+
+#endif /** @} */
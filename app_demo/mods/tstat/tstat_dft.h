@@ -0,0 +1,89 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+#ifndef __TSTAT_DFT_H_
+#define __TSTAT_DFT_H_
+
+/** @defgroup MODS_LPC8Nxx_TSTAT_DFT Diversity Settings
+ *  @ingroup MODS_LPC8Nxx_TSTAT
+ * These 'defines' capture the diversity settings of the module. The displayed values refer to the default settings.
+ * To override the default settings, place the defines with their desired values in the application app_sel.h header
+ * file: the compiler will pick up your defines before parsing this file.
+ * @{
+ */
+
+/**
+ * The lower limit of the allowed temperature range, in the same unit as the values given to #TStat_Add.
+ * The time spent below this limit is accumulated.
+ * The default value corresponds to 2.0 degrees Celsius, when deci-degrees Celsius are used.
+ */
+#if (!defined(TSTAT_LOW_THRESHOLD))
+    #define TSTAT_LOW_THRESHOLD 20
+#endif
+
+/**
+ * The upper limit of the allowed temperature range, in the same unit as the values given to #TStat_Add.
+ * The time spent above this limit is accumulated.
+ * The default value corresponds to 8.0 degrees Celsius, when deci-degrees Celsius are used.
+ */
+#if (!defined(TSTAT_HIGH_THRESHOLD))
+    #define TSTAT_HIGH_THRESHOLD 80
+#endif
+
+/**
+ * The number of histogram bins.
+ * The first and the last bin also count all values below resp. above the histogram range.
+ * @note Must be at least 1.
+ */
+#if (!defined(TSTAT_HISTOGRAM_BINS))
+    #define TSTAT_HISTOGRAM_BINS 8
+#endif
+
+/**
+ * The lowest value that is counted in the second histogram bin, in the same unit as the values given to #TStat_Add.
+ * The first bin counts all values below it.
+ */
+#if (!defined(TSTAT_HISTOGRAM_MIN))
+    #define TSTAT_HISTOGRAM_MIN (-100)
+#endif
+
+/**
+ * The width of each histogram bin is 2 to the power of this value, in the same unit as the values given to #TStat_Add.
+ * A power of two is used, so the bin of a value is found without a division.
+ * The default value, together with the default number of bins and minimum value, covers [-10.0, +28.4] degrees
+ * Celsius in steps of 6.4 degrees, when deci-degrees Celsius are used.
+ */
+#if (!defined(TSTAT_HISTOGRAM_SHIFT))
+    #define TSTAT_HISTOGRAM_SHIFT 6
+#endif
+
+/**
+ * The offset, in bytes, in EEPROM where the statistics are stored by #TStat_Save. The record occupies
+ * 42 + 2 * #TSTAT_HISTOGRAM_BINS bytes, rounded up to a multiple of 8.
+ * By default, the last writable EEPROM row is used.
+ */
+#if (!defined(TSTAT_EEPROM_OFFSET))
+    #define TSTAT_EEPROM_OFFSET ((EEPROM_NR_OF_RW_ROWS - 1) * EEPROM_ROW_SIZE)
+#endif
+
+/**
+ * The MIME type used for the NDEF record that is created by #TStat_CreateRecord.
+ */
+#if (!defined(TSTAT_MIME_TYPE))
+    #define TSTAT_MIME_TYPE "application/vnd.nxp.tstat"
+#endif
+
+/**
+ * @}
+ */
+
+#endif
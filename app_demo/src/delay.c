@@ -0,0 +1,161 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+
+#include "chip.h"
+#include "delay.h"
+#include "energy.h"
+#include "perf.h"
+
+/** The match register of the 16-bit timer used to end a sleeping wait. */
+#define DELAY_MATCH 0
+
+/** The number of busy loops timed by the calibration. */
+#define CALIBRATION_LOOPS 256
+
+/** The maximum wait per timer match: well within the 16-bit range of the timer. */
+#define MAX_SLEEP 0x8000
+
+static void SetPrescaler(void);
+static void Calibrate(void);
+static void PerfHook(bool before, int frequency);
+static void Stop(void);
+static void Sleep(uint32_t us);
+
+static bool sInitialized = false;
+
+/** Busy loops per microsecond, with 8 fractional bits. */
+static uint32_t sLoopsPerUs;
+
+/** Set when the timer match of the current sleeping wait has occurred. */
+static volatile bool sFired;
+
+/* -------------------------------------------------------------------------------- */
+
+static void SetPrescaler(void)
+{
+    ASSERT(Chip_Clock_System_GetClockFreq() >= 1000000);
+    Chip_TIMER_PrescaleSet(LPC_TIMER16_0, (uint32_t)(Chip_Clock_System_GetClockFreq() / 1000000) - 1);
+    /* A prescale counter above the new prescale value would only be cleared when it wraps around. */
+    LPC_TIMER16_0->PC = 0;
+}
+
+/**
+ * Times the busy loop against the 16-bit timer. Rounded up: the loop count for a short wait errs on the long side.
+ * This is the only division, done once per change of the System Clock frequency.
+ */
+static void Calibrate(void)
+{
+    uint32_t start;
+    uint32_t elapsed;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    start = Chip_TIMER_ReadCount(LPC_TIMER16_0);
+    Chip_Clock_System_BusyWaitLoops(CALIBRATION_LOOPS);
+    elapsed = (Chip_TIMER_ReadCount(LPC_TIMER16_0) - start) & 0xFFFF;
+    __set_PRIMASK(primask);
+
+    if (elapsed == 0) {
+        elapsed = 1;
+    }
+    sLoopsPerUs = ((CALIBRATION_LOOPS << 8) + elapsed - 1) / elapsed;
+}
+
+static void PerfHook(bool before, int frequency)
+{
+    (void)frequency;
+    if (!before) {
+        SetPrescaler();
+        Calibrate();
+    }
+}
+
+/** @pre Interrupts are disabled. */
+static void Stop(void)
+{
+    Chip_TIMER_MatchDisableInt(LPC_TIMER16_0, DELAY_MATCH);
+    Chip_TIMER_ClearMatch(LPC_TIMER16_0, DELAY_MATCH);
+    NVIC_ClearPendingIRQ(CT16B0_IRQn);
+    sFired = true;
+}
+
+/** Sleeps until the 16-bit timer has counted @c us microseconds, at most #MAX_SLEEP. */
+static void Sleep(uint32_t us)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    sFired = false;
+    Chip_TIMER_SetMatch(LPC_TIMER16_0, DELAY_MATCH, (Chip_TIMER_ReadCount(LPC_TIMER16_0) + us) & 0xFFFF);
+    Chip_TIMER_ClearMatch(LPC_TIMER16_0, DELAY_MATCH);
+    Chip_TIMER_MatchEnableInt(LPC_TIMER16_0, DELAY_MATCH);
+    Energy_Enter(ENERGY_STATE_SLEEP);
+    while (!sFired) {
+        /* Without SLEEPDEEP, WFI only halts the ARM core: Sleep, whatever PCON selects. Unlike
+         * Chip_PMU_PowerMode_EnterSleep, this costs no synchronized PMU access - of up to 100 us - per wake-up.
+         * WFI also returns on a pending interrupt while interrupts are disabled. */
+        SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+        __WFI();
+        if (Chip_TIMER_MatchPending(LPC_TIMER16_0, DELAY_MATCH)) {
+            Stop(); /* Needed when the caller has interrupts disabled. */
+        }
+        /* Lets other pending interrupts run, if the caller allows it. */
+        __set_PRIMASK(primask);
+        __disable_irq();
+    }
+    Energy_Enter(ENERGY_STATE_ACTIVE);
+    __set_PRIMASK(primask);
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void CT16B0_IRQHandler(void)
+{
+    Stop();
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void Delay_Init(void)
+{
+    Chip_TIMER16_0_Init();
+    Chip_TIMER_Disable(LPC_TIMER16_0);
+    LPC_TIMER16_0->MCR = 0;
+    SetPrescaler();
+    Chip_TIMER_Reset(LPC_TIMER16_0);
+    Chip_TIMER_Enable(LPC_TIMER16_0);
+    NVIC_EnableIRQ(CT16B0_IRQn);
+    Calibrate();
+    if (!sInitialized) {
+        Perf_RegisterHook(PerfHook);
+        Chip_Clock_System_SetWait(Delay_Us);
+        sInitialized = true;
+    }
+}
+
+void Delay_Us(uint32_t us)
+{
+    uint32_t chunk;
+
+    if (!sInitialized) {
+        Chip_Clock_System_BusyWait_us(us);
+    }
+    else if (us < DELAY_SLEEP_THRESHOLD) {
+        Chip_Clock_System_BusyWaitLoops((us * sLoopsPerUs) >> 8);
+    }
+    else {
+        while (us > 0) {
+            chunk = (us > MAX_SLEEP) ? MAX_SLEEP : us;
+            Sleep(chunk);
+            us -= chunk;
+        }
+    }
+}
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+
+#include <string.h>
+#include "chip.h"
+#include "energy.h"
+#include "power.h"
+#include "timer.h"
+#include "ndeft2t/ndeft2t.h"
+
+/**
+ * Marks a valid record in EEPROM. The number of counters is part of it, so that a change in layout invalidates it; the
+ * upper byte changes with the meaning of the other fields.
+ */
+#define ENERGY_MAGIC (0xE800 | (ENERGY_STATE_COUNT << 4) | ENERGY_OP_COUNT)
+
+/** The Deep Power Down entry time is kept in units of 2^10 us: see #Energy_GetDpdEntry. */
+#define ENERGY_DPD_ENTRY_SHIFT 10
+
+/** All counters, as kept in RAM and stored in EEPROM. */
+typedef struct ENERGY_RECORD_S {
+    uint16_t magic; /**< #ENERGY_MAGIC */
+    uint16_t checksum; /**< Makes the 16-bit sum of all half words of the record equal to 0xFFFF. */
+    uint32_t reserved;
+    uint64_t saved; /**< The value of #Timer_GetTimestamp up to which the counters are accounted. */
+    uint64_t stateTime[ENERGY_STATE_COUNT];
+    uint64_t opTime[ENERGY_OP_COUNT];
+    uint32_t stateCount[ENERGY_STATE_COUNT];
+    uint32_t opCount[ENERGY_OP_COUNT];
+    uint32_t padding; /**< Makes the size a multiple of 8 bytes: no hidden padding is left out of the checksum. */
+} ENERGY_RECORD_T;
+
+static uint16_t Checksum(const ENERGY_RECORD_T *pRecord);
+static void Fold(uint64_t now);
+
+/** In nA, in the order of #ENERGY_STATE_T. */
+static const uint32_t sStateCurrent[ENERGY_STATE_COUNT] = {
+    POWER_ACTIVE_CURRENT, POWER_SLEEP_CURRENT, POWER_DEEPSLEEP_CURRENT, POWER_DEEPPOWERDOWN_CURRENT
+};
+
+/** In pC, in the order of #ENERGY_STATE_T. Leaving a low power mode is accounted to the mode itself. */
+static const uint32_t sStateTransition[ENERGY_STATE_COUNT] = {
+    0, POWER_SLEEP_TRANSITION, POWER_DEEPSLEEP_TRANSITION, POWER_DEEPPOWERDOWN_TRANSITION
+};
+
+/** In nA, in the order of #ENERGY_OP_T. */
+static const uint32_t sOpCurrent[ENERGY_OP_COUNT] = {ENERGY_EEPROM_CURRENT, ENERGY_TSEN_CURRENT, ENERGY_NFC_CURRENT};
+
+static ENERGY_RECORD_T sRecord;
+
+static ENERGY_STATE_T sState = ENERGY_STATE_ACTIVE;
+
+/** The value of #Timer_GetTimestamp up to which the current state is accounted in sRecord. */
+static uint64_t sSince;
+
+/** One bit per running operation. */
+static uint32_t sRunning = 0;
+
+/** The value of #Timer_GetTimestamp up to which each running operation is accounted in sRecord. */
+static uint64_t sOpSince[ENERGY_OP_COUNT];
+
+/* -------------------------------------------------------------------------------- */
+
+static uint16_t Checksum(const ENERGY_RECORD_T *pRecord)
+{
+    const uint16_t *p = (const uint16_t *)pRecord;
+    uint32_t sum = 0;
+    uint32_t i;
+
+    for (i = 0; i < sizeof(ENERGY_RECORD_T) / sizeof(uint16_t); i++) {
+        sum += p[i];
+    }
+    sum -= pRecord->checksum;
+    sum = (sum & 0xFFFF) + (sum >> 16);
+    sum = (sum & 0xFFFF) + (sum >> 16);
+    return (uint16_t)~sum;
+}
+
+/**
+ * Accounts the time up to @c now to the current state and to all running operations.
+ * @pre Interrupts are disabled.
+ */
+static void Fold(uint64_t now)
+{
+    int op;
+
+    sRecord.stateTime[sState] += now - sSince;
+    sSince = now;
+    for (op = 0; op < ENERGY_OP_COUNT; op++) {
+        if (sRunning & (1u << op)) {
+            sRecord.opTime[op] += now - sOpSince[op];
+            sOpSince[op] = now;
+        }
+    }
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void Energy_Init(bool resumed, uint32_t dpdEntry)
+{
+    ENERGY_RECORD_T record;
+    uint64_t now;
+    uint64_t entry;
+
+    Chip_EEPROM_Read(LPC_EEPROM, ENERGY_EEPROM_OFFSET, &record, sizeof(ENERGY_RECORD_T));
+    if ((record.magic == ENERGY_MAGIC) && (record.checksum == Checksum(&record))) {
+        sRecord = record;
+    }
+    else {
+        Energy_Reset();
+    }
+
+    /* The time stamp is aligned with the RTC by Timer_Init, and the RTC keeps counting in Deep Power Down. After any
+     * other reset, the time since entering Deep Power Down is unknown. The counters were saved before entering it:
+     * the time in between was spent active. */
+    now = Timer_GetTimestamp();
+    if (resumed) {
+        entry = now - ((uint64_t)((uint32_t)(now >> ENERGY_DPD_ENTRY_SHIFT) - dpdEntry) << ENERGY_DPD_ENTRY_SHIFT);
+        if ((entry <= now) && (entry >= sRecord.saved)) {
+            sRecord.stateTime[ENERGY_STATE_ACTIVE] += entry - sRecord.saved;
+            sRecord.stateTime[ENERGY_STATE_DEEPPOWERDOWN] += now - entry;
+            sRecord.stateCount[ENERGY_STATE_DEEPPOWERDOWN]++;
+        }
+    }
+    sState = ENERGY_STATE_ACTIVE;
+    sRecord.stateCount[ENERGY_STATE_ACTIVE]++;
+    sSince = now;
+    sRunning = 0;
+}
+
+void Energy_Reset(void)
+{
+    int op;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    memset(&sRecord, 0, sizeof(ENERGY_RECORD_T));
+    sRecord.magic = ENERGY_MAGIC;
+    sSince = Timer_GetTimestamp();
+    sRecord.saved = sSince;
+    for (op = 0; op < ENERGY_OP_COUNT; op++) {
+        sOpSince[op] = sSince;
+    }
+    __set_PRIMASK(primask);
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void Energy_Enter(ENERGY_STATE_T state)
+{
+    uint64_t now = Timer_GetTimestamp();
+
+    ASSERT(state < ENERGY_STATE_COUNT);
+    if (sState == ENERGY_STATE_DEEPPOWERDOWN) {
+        /* Deep Power Down was not entered, because an interrupt was pending: the IC stayed active all along. */
+        ASSERT(state == ENERGY_STATE_ACTIVE);
+        sRecord.stateCount[ENERGY_STATE_DEEPPOWERDOWN]--;
+        sState = ENERGY_STATE_ACTIVE;
+        Fold(now);
+        return;
+    }
+    Fold(now);
+    sState = state;
+    sRecord.stateCount[state]++;
+    if (state == ENERGY_STATE_DEEPPOWERDOWN) {
+        /* Nothing runs on in Deep Power Down. */
+        sRunning = 0;
+    }
+}
+
+void Energy_Begin(ENERGY_OP_T op)
+{
+    uint32_t primask;
+
+    ASSERT(op < ENERGY_OP_COUNT);
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (!(sRunning & (1u << op))) {
+        sRunning |= 1u << op;
+        sOpSince[op] = Timer_GetTimestamp();
+        sRecord.opCount[op]++;
+    }
+    __set_PRIMASK(primask);
+}
+
+void Energy_End(ENERGY_OP_T op)
+{
+    uint32_t primask;
+
+    ASSERT(op < ENERGY_OP_COUNT);
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (sRunning & (1u << op)) {
+        sRecord.opTime[op] += Timer_GetTimestamp() - sOpSince[op];
+        sRunning &= ~(1u << op);
+    }
+    __set_PRIMASK(primask);
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void Energy_GetReport(ENERGY_REPORT_T *pReport)
+{
+    ENERGY_RECORD_T record;
+    uint64_t charge = 0; /* In pC. */
+    int n;
+    uint32_t primask;
+
+    ASSERT(pReport != NULL);
+    primask = __get_PRIMASK();
+    __disable_irq();
+    Fold(Timer_GetTimestamp());
+    record = sRecord;
+    __set_PRIMASK(primask);
+
+    /* ms * nA = pC */
+    for (n = 0; n < ENERGY_STATE_COUNT; n++) {
+        pReport->stateTime[n] = record.stateTime[n];
+        pReport->stateCount[n] = record.stateCount[n];
+        charge += (record.stateTime[n] / 1000) * sStateCurrent[n];
+        charge += (uint64_t)record.stateCount[n] * sStateTransition[n];
+    }
+    for (n = 0; n < ENERGY_OP_COUNT; n++) {
+        pReport->opTime[n] = record.opTime[n];
+        pReport->opCount[n] = record.opCount[n];
+        charge += (record.opTime[n] / 1000) * sOpCurrent[n];
+    }
+    charge /= 1000000;
+    pReport->charge = (charge > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32_t)charge;
+}
+
+void Energy_Save(void)
+{
+    ENERGY_RECORD_T record;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    sRecord.saved = Timer_GetTimestamp();
+    Fold(sRecord.saved);
+    record = sRecord;
+    __set_PRIMASK(primask);
+
+    record.checksum = Checksum(&record);
+    Energy_Begin(ENERGY_OP_EEPROM);
+    Chip_EEPROM_Write(LPC_EEPROM, ENERGY_EEPROM_OFFSET, &record, sizeof(ENERGY_RECORD_T));
+    Chip_EEPROM_Flush(LPC_EEPROM, true);
+    Energy_End(ENERGY_OP_EEPROM);
+}
+
+uint32_t Energy_GetDpdEntry(void)
+{
+    return (uint32_t)(Timer_GetTimestamp() >> ENERGY_DPD_ENTRY_SHIFT);
+}
+
+bool Energy_CreateRecord(void *pInstance)
+{
+    NDEFT2T_CREATE_RECORD_INFO_T recordInfo = {.pString = (uint8_t *)ENERGY_MIME_TYPE, .shortRecord = true};
+    ENERGY_REPORT_T report;
+
+    Energy_GetReport(&report);
+    if (NDEFT2T_CreateMimeRecord(pInstance, &recordInfo)
+            && NDEFT2T_WriteRecordPayload(pInstance, &report, ENERGY_REPORT_SIZE)) {
+        NDEFT2T_CommitRecord(pInstance);
+        return true;
+    }
+    return false;
+}
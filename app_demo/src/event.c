@@ -0,0 +1,125 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+
+#include "chip.h"
+#include "event.h"
+#include "timer.h"
+#include "power.h"
+
+/** One bit per event: set by #Event_Post, cleared just before the handler is called. */
+static volatile uint32_t sPending = 0;
+
+/** The number of calls to #Event_LockDeepSleep not yet undone. */
+static volatile int sDeepSleepLocks = 0;
+
+static EVENT_HANDLER_T sHandlers[EVENT_COUNT];
+
+/** The value of #Timer_GetFreeRunning when each event was posted, while pending. */
+static uint32_t sPostTime[EVENT_COUNT];
+
+static uint32_t sMaxLatency[EVENT_COUNT];
+
+/* -------------------------------------------------------------------------------- */
+
+void Event_Init(void)
+{
+    int n;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    sPending = 0;
+    sDeepSleepLocks = 0;
+    for (n = 0; n < EVENT_COUNT; n++) {
+        sHandlers[n] = NULL;
+        sMaxLatency[n] = 0;
+    }
+    __set_PRIMASK(primask);
+}
+
+void Event_Register(int event, EVENT_HANDLER_T handler)
+{
+    ASSERT((event >= 0) && (event < EVENT_COUNT));
+    sHandlers[event] = handler;
+}
+
+void Event_Post(int event)
+{
+    uint32_t primask;
+
+    ASSERT((event >= 0) && (event < EVENT_COUNT));
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (!(sPending & (1u << event))) {
+        sPending |= 1u << event;
+        sPostTime[event] = Timer_GetFreeRunning();
+    }
+    __set_PRIMASK(primask);
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void Event_LockDeepSleep(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    sDeepSleepLocks++;
+    __set_PRIMASK(primask);
+}
+
+void Event_UnlockDeepSleep(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    ASSERT(sDeepSleepLocks > 0);
+    sDeepSleepLocks--;
+    __set_PRIMASK(primask);
+}
+
+uint32_t Event_GetMaxLatency(int event)
+{
+    ASSERT((event >= 0) && (event < EVENT_COUNT));
+    return sMaxLatency[event];
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void Event_Run(void)
+{
+    int event;
+    uint32_t latency;
+
+    for (;;) {
+        /* Interrupts stay disabled from checking the bitmap up to entering a low power mode: an interrupt posting an
+         * event in between would otherwise go unnoticed until the next wake-up. WFI still returns on a pending
+         * interrupt; its handler runs as soon as interrupts are enabled again. */
+        __disable_irq();
+        if (sPending == 0) {
+            Power_Idle((sDeepSleepLocks == 0) ? POWER_STATE_DEEPPOWERDOWN : POWER_STATE_SLEEP);
+            __enable_irq();
+        }
+        else {
+            for (event = 0; !(sPending & (1u << event)); event++) {
+                ; /* Find the lowest pending event. */
+            }
+            sPending &= ~(1u << event);
+            latency = Timer_GetFreeRunning() - sPostTime[event];
+            __enable_irq();
+
+            if (latency > sMaxLatency[event]) {
+                sMaxLatency[event] = latency;
+            }
+            if (sHandlers[event] != NULL) {
+                sHandlers[event]();
+            }
+        }
+    }
+}
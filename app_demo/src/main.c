@@ -13,44 +13,69 @@
 #include <string.h>
 #include "board.h"
 #include "ndeft2t/ndeft2t.h"
+#include "ckpt/ckpt.h"
+#include "calib/calib.h"
 #include "tmeas/tmeas.h"
+#include "tstat/tstat.h"
+#include "ledpat/ledpat.h"
+#include "health/health.h"
 #include "timer.h"
+#include "event.h"
+#include "energy.h"
+#include "power.h"
+#include "perf.h"
+#include "delay.h"
 #include "app_sel.h"
 
-#define SYSTICK_INTERVAL (1000)// ms
-#define CT16B_INTERVAL (1)// ms
-
+#define BLINK_INTERVAL (1000)// ms
+#define BLINK_COUNT (5)// blinks after a cold start; a running pattern keeps the IC out of Deep Power Down
+#define MEASUREMENT_INTERVAL (60)// s
+#define MEASUREMENT_SLACK (5)// s, the measurement may be postponed to share a wake-up
+#define SAVE_INTERVAL (60)// measurements
+#define MEASUREMENT_DEADLINE (2 * (MEASUREMENT_INTERVAL + MEASUREMENT_SLACK))// s, between completed measurements
+
+/** The events handled by the main loop, in order of priority. */
+typedef enum APP_EVENT {
+    APP_EVENT_TSEN, /**< A temperature measurement has completed. */
+    APP_EVENT_MEASURE, /**< A new temperature measurement is due. */
+} APP_EVENT_T;
+
+/** The application state kept across Deep Power Down. */
+typedef struct APP_CHECKPOINT_S {
+    uint32_t cycles; /**< The number of Deep Power Down cycles since the last cold start. */
+    int32_t measurementsUntilSave;
+    uint32_t dpdEntry; /**< See #Energy_GetDpdEntry. */
+} APP_CHECKPOINT_T; /* 12 bytes: fits in the PMU retained data, see CKPT_RETAINED_COUNT in app_sel.h. */
 
 static void Init(void);
+static void PostEventCb(uint32_t context);
+static void TsenHandler(void);
+static void MeasureHandler(void);
+static bool SaveCheckpointCb(void);
 /* -------------------------------------------------------------------------
  * variables
  * ------------------------------------------------------------------------- */
 
-static void Init(void)
-{
-    Chip_Clock_System_SetClockFreq(1 * 1000 * 1000);
-
-	while( SysTick_Config(1 * 1000 * SYSTICK_INTERVAL) )
-	{
-		;
-	}
+static TIMER_T sMeasureTimer;
+static int sMeasurementsUntilSave = SAVE_INTERVAL;
+static APP_CHECKPOINT_T sCheckpoint;
 
-	// RTC
-	Chip_RTC_DeInit(LPC_RTC);
-	Chip_Clock_Peripheral_EnableClock(CLOCK_PERIPHERAL_RTC);// ʹRTCʱ
-	Chip_RTC_Int_SetEnabledMask(LPC_RTC, RTC_INT_NONE);// RTCж
+/** The health monitor ID of the measurement cycle. */
+static int sMeasurementTask;
 
-	// CT16B
-	Chip_Clock_Peripheral_EnableClock(CLOCK_PERIPHERAL_16TIMER0);
+/** The value of #Timer_GetFreeRunning right after #Timer_Init: the start of the time spent awake. */
+static uint32_t sWakeTime;
 
-	Chip_TIMER_Init(LPC_TIMER16_0, CLOCK_PERIPHERAL_16TIMER0);
-	Chip_TIMER_PrescaleSet(LPC_TIMER16_0, 1000);// PR  PC==PR --> TC++
-	Chip_TIMER_SetMatch(LPC_TIMER16_0, 0, CT16B_INTERVAL);// MR(x)  TC==MR(X) --> INT
-	
-	Chip_TIMER_MatchEnableInt(LPC_TIMER16_0, 0);
+static void Init(void)
+{
+    Perf_Init(PERF_LEVEL_LOW);
+    Delay_Init();
 
-	NVIC_EnableIRQ(CT16B0_IRQn);
-	Chip_TIMER_Enable(LPC_TIMER16_0);
+	Timer_Init();
+	sWakeTime = Timer_GetFreeRunning();
+	Event_Init();
+	Power_Init();
+	Health_Init();
 
 	// GPIO
     Board_Init();
@@ -70,39 +95,114 @@ static void Init(void)
 
     LPC_GPIO->DATA[0xFFF] = 0;
     LPC_GPIO->DIR = (LPC_GPIO->DIR & 0xFFF) | 0x3FF;
+    LED_Init();
+
+    Chip_EEPROM_Init(LPC_EEPROM);
+    Calib_Init();
+    TStat_Init();
+}
+
+/* The context of each measurement request is the time, in seconds, since the previous measurement. */
+void App_TmeasCb(TSEN_RESOLUTION_T resolution, TMEAS_FORMAT_T format, int value, uint32_t context)
+{
+    Energy_End(ENERGY_OP_TSEN);
+    if (format == TMEAS_FORMAT_CELSIUS) {
+        TStat_Add(value, context, resolution);
+    }
+    Event_Post(APP_EVENT_TSEN);
 }
 
-uint16_t systick_test_cnt = 0, ct16b0_test_cnt = 0;
-int rtc_time_test_cnt = 0;
+/* Timer callback: defers all work to the main loop. The context is the event to post. */
+static void PostEventCb(uint32_t context)
+{
+    Event_Post((int)context);
+}
 
-void SysTick_Handler(void)
+static void TsenHandler(void)
 {
-	systick_test_cnt++;
+    /* The conversion is done: the TSEN interrupt no longer needs to wake us up. */
+    Event_UnlockDeepSleep();
+    if (--sMeasurementsUntilSave <= 0) {
+        sMeasurementsUntilSave = SAVE_INTERVAL;
+        Energy_Begin(ENERGY_OP_EEPROM);
+        TStat_Save(true); /* Wait: the EEPROM is powered down in Deep Sleep. */
+        Energy_End(ENERGY_OP_EEPROM);
+        Energy_Save();
+    }
+    /* A full cycle - measurement and storage - is done. */
+    Health_CheckIn(sMeasurementTask);
+}
 
-	rtc_time_test_cnt = Chip_RTC_Time_GetValue(LPC_RTC);
-	Chip_GPIO_SetPinToggle(LPC_GPIO, 0, 6);
+static void MeasureHandler(void)
+{
+    Timer_StartWithSlack(&sMeasureTimer, MEASUREMENT_INTERVAL * 1000, MEASUREMENT_SLACK * 1000, PostEventCb,
+            APP_EVENT_MEASURE);
+    /* The TSEN interrupt is no Start Logic source: stay out of Deep Sleep until the conversion is done. */
+    Event_LockDeepSleep();
+    Energy_Begin(ENERGY_OP_TSEN);
+    if (TMeas_Measure(TSEN_10BITS, TMEAS_FORMAT_CELSIUS, false, MEASUREMENT_INTERVAL) == TMEAS_ERROR) {
+        Energy_End(ENERGY_OP_TSEN);
+        Event_UnlockDeepSleep();
+    }
 }
 
-void CT16B0_IRQHandler(void)
+/* Called by the power manager with interrupts disabled, just before entering Deep Power Down. */
+static bool SaveCheckpointCb(void)
 {
-	if( Chip_TIMER_MatchPending(LPC_TIMER16_0, 0) )
-	{
-		ct16b0_test_cnt++;
-		Chip_TIMER_ClearMatch(LPC_TIMER16_0, 0);
-		LPC_TIMER16_0->TC = 0;
-	}
+    /* The measurements since the last save only live in RAM. Saving them on every Deep Power Down would program the
+     * EEPROM each measurement: wait for the scheduled save in Deep Sleep instead. Unless nothing is to wake us up
+     * before that save is due: then this is the last chance. */
+    if (sMeasurementsUntilSave < SAVE_INTERVAL) {
+        if ((uint64_t)Timer_GetIdleTime() < (uint64_t)sMeasurementsUntilSave * MEASUREMENT_INTERVAL * 1000000) {
+            return false;
+        }
+        sMeasurementsUntilSave = SAVE_INTERVAL;
+        Energy_Begin(ENERGY_OP_EEPROM);
+        TStat_Save(true);
+        Energy_End(ENERGY_OP_EEPROM);
+        Energy_Save();
+    }
+    /* Only PMU retained data from here on: no EEPROM is programmed. */
+    ASSERT(sizeof(APP_CHECKPOINT_T) <= CKPT_RETAINED_SIZE);
+    sCheckpoint.measurementsUntilSave = sMeasurementsUntilSave;
+    sCheckpoint.dpdEntry = Energy_GetDpdEntry();
+    Ckpt_Save(&sCheckpoint, sizeof(APP_CHECKPOINT_T), Timer_GetFreeRunning() - sWakeTime);
+    return true;
 }
 
-void CT32B0_IRQHandler(void)
+/* Field status callback of the ndeft2t module, see NDEFT2T_FIELD_STATUS_CB in app_sel.h. */
+void NDEFT2T_FieldStatus_Cb(bool status)
 {
-	
+    if (status) {
+        Energy_Begin(ENERGY_OP_NFC);
+    }
+    else {
+        Energy_End(ENERGY_OP_NFC);
+    }
 }
 
-uint16_t while_test_cnt = 0;
 int System_ClockDiv, System_ClockFreq;
+uint32_t App_ActiveTime; /* The time in us spent awake before the last Deep Power Down, from Timer_Init onwards. */
 int main(void)
 {
+	bool restored;
+	bool resumed;
+
+	Ckpt_Init(); /* Before anything can clear the Deep Power Down wake-up reason. */
 	Init();
+	restored = Ckpt_Restore(&sCheckpoint, sizeof(APP_CHECKPOINT_T));
+	resumed = restored && (Ckpt_GetWakeupReason() == PMU_DPD_WAKEUPREASON_RTC);
+	if (restored) {
+		/* Counted after waking up: Deep Power Down is not entered when an interrupt is pending. */
+		sCheckpoint.cycles++;
+		sMeasurementsUntilSave = sCheckpoint.measurementsUntilSave;
+		App_ActiveTime = Ckpt_GetActiveTime();
+	}
+	else {
+		sCheckpoint.cycles = 0;
+	}
+	Energy_Init(restored, sCheckpoint.dpdEntry);
+	Power_SetDeepPowerDown(SaveCheckpointCb, false);
 
 	System_ClockDiv = Chip_Clock_System_GetClockDiv();
 	System_ClockFreq = Chip_Clock_System_GetClockFreq();
@@ -111,10 +211,21 @@ int main(void)
 	Chip_GPIO_SetPinState(LPC_GPIO, 0, 2, true);
 	Chip_GPIO_SetPinState(LPC_GPIO, 0, 4, true);
 	Chip_GPIO_SetPinState(LPC_GPIO, 0, 5, true);
-	
-	while(1)
-	{
-		while_test_cnt = LPC_TIMER16_0->PC;
+
+	sMeasurementTask = Health_Register(MEASUREMENT_DEADLINE * 1000);
+	Event_Register(APP_EVENT_TSEN, TsenHandler);
+	Event_Register(APP_EVENT_MEASURE, MeasureHandler);
+	if (resumed) {
+		/* Fast path: the RTC woke us up for the next measurement. Take it right away, without blinking: when it is
+		 * done, nothing keeps the IC awake and it returns to Deep Power Down. */
+		Event_Post(APP_EVENT_MEASURE);
 	}
+	else {
+		Timer_StartWithSlack(&sMeasureTimer, MEASUREMENT_INTERVAL * 1000, MEASUREMENT_SLACK * 1000, PostEventCb,
+		        APP_EVENT_MEASURE);
+		LedPat_Blink(LED_RED, BLINK_INTERVAL, BLINK_INTERVAL, BLINK_COUNT);
+	}
+
+	Event_Run();
 	//return 0;
 }
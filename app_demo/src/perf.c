@@ -0,0 +1,151 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+
+#include "chip.h"
+#include "perf.h"
+#include "timer.h"
+
+typedef struct PERF_SETTINGS_S {
+    int frequency; /**< In Hz. */
+    int waitStates;
+    bool highPower;
+} PERF_SETTINGS_T;
+
+static const PERF_SETTINGS_T sSettings[PERF_LEVEL_COUNT] = {
+    {PERF_LOW_FREQUENCY, PERF_LOW_WAITSTATES, PERF_LOW_HIGHPOWER},
+    {PERF_MEDIUM_FREQUENCY, PERF_MEDIUM_WAITSTATES, PERF_MEDIUM_HIGHPOWER},
+    {PERF_HIGH_FREQUENCY, PERF_HIGH_WAITSTATES, PERF_HIGH_HIGHPOWER}
+};
+
+static PERF_LEVEL_T sLevel = PERF_LEVEL_LOW;
+
+static PERF_HOOK_T sHooks[PERF_MAX_HOOKS];
+
+static int sHookCount = 0;
+
+static void SetFlash(int waitStates, bool highPower);
+static void CallHooks(bool before, int frequency);
+
+/* -------------------------------------------------------------------------------- */
+
+/**
+ * Configures the flash. Wait states are added before, and removed after leaving high power mode: at no point is the
+ * flash left without both at a System Clock divider of 1.
+ */
+static void SetFlash(int waitStates, bool highPower)
+{
+    if (waitStates > 0) {
+        Chip_Flash_SetNumWaitStates(waitStates);
+        Chip_Flash_SetHighPowerMode(highPower);
+    }
+    else {
+        Chip_Flash_SetHighPowerMode(highPower);
+        Chip_Flash_SetNumWaitStates(waitStates);
+    }
+}
+
+static void CallHooks(bool before, int frequency)
+{
+    int n;
+
+    for (n = 0; n < sHookCount; n++) {
+        sHooks[n](before, frequency);
+    }
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void Perf_Init(PERF_LEVEL_T level)
+{
+    const PERF_SETTINGS_T *pSettings;
+
+    ASSERT(level < PERF_LEVEL_COUNT);
+    pSettings = &sSettings[level];
+    sHookCount = 0;
+    SetFlash((Chip_Flash_GetNumWaitStates() > pSettings->waitStates) ? Chip_Flash_GetNumWaitStates()
+            : pSettings->waitStates, Chip_Flash_GetHighPowerMode() || pSettings->highPower);
+    Chip_Clock_System_SetClockFreq(pSettings->frequency);
+    SetFlash(pSettings->waitStates, pSettings->highPower);
+    sLevel = level;
+}
+
+void Perf_RegisterHook(PERF_HOOK_T hook)
+{
+    ASSERT((hook != NULL) && (sHookCount < PERF_MAX_HOOKS));
+    sHooks[sHookCount++] = hook;
+}
+
+PERF_LEVEL_T Perf_SetLevel(PERF_LEVEL_T level)
+{
+    const PERF_SETTINGS_T *pOld;
+    const PERF_SETTINGS_T *pNew;
+    PERF_LEVEL_T previous = sLevel;
+    bool i2c;
+    uint32_t i2cRate = 0;
+    bool ssp;
+    uint32_t sspRate = 0;
+    uint32_t primask;
+
+    ASSERT(level < PERF_LEVEL_COUNT);
+    if (level == sLevel) {
+        return previous;
+    }
+    pOld = &sSettings[sLevel];
+    pNew = &sSettings[level];
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    CallHooks(true, pNew->frequency);
+    i2c = ((Chip_Clock_Peripheral_GetClockEnabled() & CLOCK_PERIPHERAL_I2C0) != 0)
+            && ((LPC_I2C->SCLH + LPC_I2C->SCLL) != 0);
+    if (i2c) {
+        i2cRate = Chip_I2C_GetClockRate(I2C0);
+    }
+    ssp = ((Chip_Clock_Peripheral_GetClockEnabled() & CLOCK_PERIPHERAL_SPI0) != 0)
+            && (Chip_Clock_SPI0_GetClockDiv() != 0);
+    if (ssp) {
+        sspRate = Chip_SSP_GetBitRate(LPC_SSP0);
+        /* Let the frames in the TX FIFO go out at the old rate. */
+        while (Chip_SSP_GetStatus(LPC_SSP0, SSP_STAT_BSY)) {
+        }
+    }
+    if (Chip_Clock_Peripheral_GetClockEnabled() & CLOCK_PERIPHERAL_EEPROM) {
+        Chip_EEPROM_SetClockFreq(LPC_EEPROM, pNew->frequency);
+    }
+
+    /* The union of both flash settings is safe at both frequencies. */
+    SetFlash((pOld->waitStates > pNew->waitStates) ? pOld->waitStates : pNew->waitStates,
+            pOld->highPower || pNew->highPower);
+    Chip_Clock_System_SetClockFreq(pNew->frequency);
+    SetFlash(pNew->waitStates, pNew->highPower);
+    sLevel = level;
+
+    Timer_UpdateClock();
+    if (i2c) {
+        Chip_I2C_SetClockRate(I2C0, i2cRate);
+    }
+    if (ssp) {
+        /* The SPI0 clock divider must follow the System Clock divider - see Chip_SSP_Init - which changes the SSP
+         * clock: the bit rate is set again. */
+        Chip_Clock_SPI0_SetClockDiv(Chip_Clock_System_GetClockDiv());
+        Chip_SSP_SetBitRate(LPC_SSP0, sspRate);
+    }
+    CallHooks(false, pNew->frequency);
+    __set_PRIMASK(primask);
+    return previous;
+}
+
+PERF_LEVEL_T Perf_GetLevel(void)
+{
+    return sLevel;
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+
+#include "chip.h"
+#include "energy.h"
+#include "power.h"
+#include "timer.h"
+
+/** Start Logic sources that can also end Deep Power Down. PIO pins cannot, except the WAKEUP pin through the PMU. */
+#define DPD_SOURCES (SYSCON_STARTSOURCE_NFC | SYSCON_STARTSOURCE_RTC)
+
+typedef struct POWER_COST_S {
+    uint32_t current; /**< In nA. */
+    uint32_t transition; /**< In pC. */
+    uint32_t latency; /**< In us. */
+} POWER_COST_T;
+
+static const POWER_COST_T sCosts[POWER_STATE_COUNT] = {
+    {POWER_SLEEP_CURRENT, POWER_SLEEP_TRANSITION, POWER_SLEEP_LATENCY},
+    {POWER_DEEPSLEEP_CURRENT, POWER_DEEPSLEEP_TRANSITION, POWER_DEEPSLEEP_LATENCY},
+    {
+        POWER_DEEPPOWERDOWN_CURRENT,
+        POWER_DEEPPOWERDOWN_TRANSITION + (POWER_DEEPPOWERDOWN_EEPROM_ROWS * POWER_EEPROM_ROW_CHARGE),
+        POWER_DEEPPOWERDOWN_LATENCY
+    }
+};
+
+/** The Start Logic sources enabled in Deep Sleep, always including the RTC. */
+static SYSCON_STARTSOURCE_T sSources = SYSCON_STARTSOURCE_RTC;
+
+static bool sWakeupPin = false;
+
+/** Deep Power Down is only used when not @c NULL. */
+static POWER_DPD_CB_T sDpdCb = NULL;
+
+static bool sSwitching = false;
+
+static void WakeUp(void);
+
+/* -------------------------------------------------------------------------------- */
+
+/**
+ * Clears the NFC Start Logic interrupt that may have ended Deep Sleep, before its handler gets a chance to run: the NFC
+ * interrupt carries the event itself. The PIO Start Logic interrupts are left to their handlers: the GPIO block is not
+ * clocked in Deep Sleep, and the PIO0 interrupt may have missed the edge. The RTC Start Logic interrupt is handled by
+ * the timer service.
+ * @pre Interrupts are disabled.
+ */
+static void WakeUp(void)
+{
+    if (sSources & SYSCON_STARTSOURCE_NFC) {
+        Chip_SysCon_StartLogic_ClearStatus(SYSCON_STARTSOURCE_NFC);
+        NVIC_ClearPendingIRQ(RFFIELD_IRQn);
+    }
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void Power_Init(void)
+{
+    Power_SetWakeSources(SYSCON_STARTSOURCE_NONE, false);
+    Power_SetDeepPowerDown(NULL, false);
+}
+
+void Power_SetWakeSources(SYSCON_STARTSOURCE_T sources, bool wakeupPin)
+{
+    int n;
+
+    sSources = (SYSCON_STARTSOURCE_T)(sources | SYSCON_STARTSOURCE_RTC);
+    sWakeupPin = wakeupPin;
+
+    /* Only an enabled interrupt ends Deep Sleep. The Start Logic interrupt numbers equal the source bit numbers. The
+     * RTC Start Logic interrupt is handled by the timer service. */
+    Chip_SysCon_StartLogic_ClearStatus((SYSCON_STARTSOURCE_T)(sSources & ~SYSCON_STARTSOURCE_RTC));
+    for (n = PIO0_0_IRQn; n < RTCPWREQ_IRQn; n++) {
+        NVIC_ClearPendingIRQ((IRQn_Type)n);
+        if (sSources & (1 << n)) {
+            NVIC_EnableIRQ((IRQn_Type)n);
+        }
+        else {
+            NVIC_DisableIRQ((IRQn_Type)n);
+        }
+    }
+}
+
+void Power_SetDeepPowerDown(POWER_DPD_CB_T cb, bool enableSwitching)
+{
+    sDpdCb = cb;
+    sSwitching = enableSwitching;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+uint64_t Power_GetCost(POWER_STATE_T state, uint32_t idle)
+{
+    ASSERT(state < POWER_STATE_COUNT);
+    /* nA * us = fC */
+    return ((uint64_t)sCosts[state].current * idle) + ((uint64_t)sCosts[state].transition * 1000);
+}
+
+POWER_STATE_T Power_Select(POWER_STATE_T deepest)
+{
+    POWER_STATE_T state;
+    POWER_STATE_T selected = POWER_STATE_SLEEP;
+    uint64_t cost;
+    uint64_t lowest;
+    uint32_t idle;
+
+    ASSERT(deepest < POWER_STATE_COUNT);
+    if (Timer_IsFastRunning()) {
+        /* The 32-bit timer interrupt is no Start Logic source. */
+        return POWER_STATE_SLEEP;
+    }
+    if ((sDpdCb == NULL) || (sSources & ~DPD_SOURCES)) {
+        deepest = (deepest < POWER_STATE_DEEPSLEEP) ? deepest : POWER_STATE_DEEPSLEEP;
+    }
+
+    idle = Timer_GetIdleTime();
+    lowest = Power_GetCost(POWER_STATE_SLEEP, idle);
+    for (state = POWER_STATE_DEEPSLEEP; state <= deepest; state++) {
+        cost = Power_GetCost(state, idle);
+        if ((idle >= sCosts[state].latency) && (cost < lowest)) {
+            lowest = cost;
+            selected = state;
+        }
+    }
+    return selected;
+}
+
+POWER_STATE_T Power_Idle(POWER_STATE_T deepest)
+{
+    POWER_STATE_T state = Power_Select(deepest);
+
+    if ((state == POWER_STATE_DEEPPOWERDOWN) && sDpdCb()) {
+        Energy_Enter(ENERGY_STATE_DEEPPOWERDOWN);
+        /* The wakeup pin setting is written together with the power mode: one synchronized PMU access less. */
+        Chip_PMU_Batch_Begin();
+        Chip_PMU_SetWakeupPinEnabled(sWakeupPin);
+        Chip_PMU_PowerMode_EnterDeepPowerDown(sSwitching);
+        /* Only reached when an interrupt was pending already: Deep Power Down was not entered. The power mode wrote
+         * the batched setting, so ending the batch costs no synchronized access. */
+        Chip_PMU_Batch_Commit();
+        /* The IC never stopped running. Return right away: the pending interrupt may have posted an event, and the
+         * next idle period is to be selected anew. */
+        Energy_Enter(ENERGY_STATE_ACTIVE);
+        return POWER_STATE_DEEPPOWERDOWN;
+    }
+
+    if (state == POWER_STATE_SLEEP) {
+        Energy_Enter(ENERGY_STATE_SLEEP);
+        Chip_PMU_PowerMode_EnterSleep();
+    }
+    else {
+        state = POWER_STATE_DEEPSLEEP;
+        Chip_SysCon_StartLogic_SetEnabledMask(sSources);
+        Energy_Enter(ENERGY_STATE_DEEPSLEEP);
+        Chip_PMU_PowerMode_EnterDeepSleep();
+        WakeUp();
+        /* The 32-bit timer was halted together with the System Clock. */
+        Timer_SyncTimestamp();
+    }
+    Energy_Enter(ENERGY_STATE_ACTIVE);
+    return state;
+}
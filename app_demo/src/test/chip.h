@@ -0,0 +1,51 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/* Host stand-in for the chip library: only what the power manager uses. The PMU calls are recorded by the test. */
+
+#ifndef __CHIP_H_
+#define __CHIP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <assert.h>
+
+#define ASSERT(expression) assert(expression)
+
+typedef enum IRQn {
+    PIO0_0_IRQn = 0,
+    RFFIELD_IRQn = 11,
+    RTCPWREQ_IRQn = 12
+} IRQn_Type;
+
+typedef enum SYSCON_STARTSOURCE {
+    SYSCON_STARTSOURCE_PIO0_0 = (1 << 0),
+    SYSCON_STARTSOURCE_NFC = (1 << 11),
+    SYSCON_STARTSOURCE_RTC = (1 << 12),
+    SYSCON_STARTSOURCE_NONE = 0
+} SYSCON_STARTSOURCE_T;
+
+static inline void NVIC_EnableIRQ(IRQn_Type irq) { (void)irq; }
+static inline void NVIC_DisableIRQ(IRQn_Type irq) { (void)irq; }
+static inline void NVIC_ClearPendingIRQ(IRQn_Type irq) { (void)irq; }
+static inline void Chip_SysCon_StartLogic_ClearStatus(SYSCON_STARTSOURCE_T sources) { (void)sources; }
+static inline void Chip_SysCon_StartLogic_SetEnabledMask(SYSCON_STARTSOURCE_T mask) { (void)mask; }
+
+void Chip_PMU_Batch_Begin(void);
+void Chip_PMU_Batch_Commit(void);
+void Chip_PMU_SetWakeupPinEnabled(bool enabled);
+void Chip_PMU_PowerMode_EnterSleep(void);
+void Chip_PMU_PowerMode_EnterDeepSleep(void);
+void Chip_PMU_PowerMode_EnterDeepPowerDown(bool enableSwitching);
+
+#endif
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/*
+ * Host test of the power manager. Timer schedules are replayed through Power_Select: every idle period must be spent
+ * in the mode that is cheapest according to Power_GetCost, among the modes that can be left in time and that the wake
+ * sources allow. A Deep Power Down that is not entered, because an interrupt is pending, must return to the caller
+ * as active time.
+ */
+
+#include <stdio.h>
+#include "power.h"
+#include "energy.h"
+#include "timer.h"
+
+/* ------------------------------------------------------------------------- */
+
+#define CHECK(condition) Check((condition), #condition, __LINE__)
+
+/** One step of a schedule: @c count idle periods of @c idle us, in which at most @c deepest may be used. */
+typedef struct STEP_S {
+    uint32_t idle;
+    POWER_STATE_T deepest;
+    int count;
+} STEP_T;
+
+/* ------------------------------------------------------------------------- */
+
+static int sFailures;
+
+/* Inputs of the power manager. */
+static uint32_t sIdle;
+static bool sFastRunning;
+static bool sDpdAllowed;
+
+/* Recorded calls. */
+static int sBatchDepth;
+static int sDpdCalls;
+static int sDpdEntries;
+static int sDeepSleepEntries;
+static int sSleepEntries;
+static ENERGY_STATE_T sEnergyState = ENERGY_STATE_ACTIVE;
+
+/** The application of the demo: 5 blinks after a cold start, then a 10-bit measurement every minute, for an hour. */
+static const STEP_T sDemoSchedule[] = {
+    {1000000, POWER_STATE_DEEPSLEEP, 10}, /* A running LED pattern keeps the IC out of Deep Power Down. */
+    {26000, POWER_STATE_SLEEP, 60}, /* The TSEN interrupt is no Start Logic source. */
+    {59974000, POWER_STATE_DEEPPOWERDOWN, 60},
+    {0, POWER_STATE_COUNT, 0}
+};
+
+/** An NFC session: short gaps between messages of a reader, up to a long gap after the reader has left. */
+static const STEP_T sNfcSchedule[] = {
+    {50, POWER_STATE_DEEPPOWERDOWN, 100},
+    {400, POWER_STATE_DEEPPOWERDOWN, 100},
+    {2000, POWER_STATE_DEEPPOWERDOWN, 50},
+    {40000, POWER_STATE_DEEPPOWERDOWN, 20},
+    {1000000, POWER_STATE_DEEPPOWERDOWN, 5},
+    {0, POWER_STATE_COUNT, 0}
+};
+
+/* ------------------------------------------------------------------------- */
+
+static void Check(bool condition, const char *text, int line)
+{
+    if (!condition) {
+        if (sFailures < 20) {
+            printf("FAIL line %d: %s\n", line, text);
+        }
+        sFailures++;
+    }
+}
+
+/* Stubs of the timer service and of the energy counters. */
+
+bool Timer_IsFastRunning(void)
+{
+    return sFastRunning;
+}
+
+uint32_t Timer_GetIdleTime(void)
+{
+    return sIdle;
+}
+
+void Timer_SyncTimestamp(void)
+{
+}
+
+void Energy_Enter(ENERGY_STATE_T state)
+{
+    sEnergyState = state;
+}
+
+/* Stubs of the PMU driver. Deep Power Down always returns, as it does when an interrupt is pending. */
+
+void Chip_PMU_Batch_Begin(void)
+{
+    sBatchDepth++;
+}
+
+void Chip_PMU_Batch_Commit(void)
+{
+    CHECK(sBatchDepth > 0);
+    sBatchDepth--;
+}
+
+void Chip_PMU_SetWakeupPinEnabled(bool enabled)
+{
+    (void)enabled;
+}
+
+void Chip_PMU_PowerMode_EnterSleep(void)
+{
+    CHECK(sEnergyState == ENERGY_STATE_SLEEP);
+    sSleepEntries++;
+}
+
+void Chip_PMU_PowerMode_EnterDeepSleep(void)
+{
+    CHECK(sEnergyState == ENERGY_STATE_DEEPSLEEP);
+    sDeepSleepEntries++;
+}
+
+void Chip_PMU_PowerMode_EnterDeepPowerDown(bool enableSwitching)
+{
+    (void)enableSwitching;
+    CHECK(sEnergyState == ENERGY_STATE_DEEPPOWERDOWN);
+    sDpdEntries++;
+}
+
+static bool DpdCb(void)
+{
+    sDpdCalls++;
+    return sDpdAllowed;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/** Returns the time to leave @c state, as listed in power.h. */
+static uint32_t Latency(POWER_STATE_T state)
+{
+    static const uint32_t latency[POWER_STATE_COUNT] = {
+        POWER_SLEEP_LATENCY, POWER_DEEPSLEEP_LATENCY, POWER_DEEPPOWERDOWN_LATENCY
+    };
+    return latency[state];
+}
+
+/** The reference selection: the cheapest mode up to @c deepest that can be left in time. Sleep wins ties. */
+static POWER_STATE_T Cheapest(uint32_t idle, POWER_STATE_T deepest)
+{
+    POWER_STATE_T state;
+    POWER_STATE_T cheapest = POWER_STATE_SLEEP;
+
+    for (state = POWER_STATE_DEEPSLEEP; state <= deepest; state++) {
+        if ((idle >= Latency(state)) && (Power_GetCost(state, idle) < Power_GetCost(cheapest, idle))) {
+            cheapest = state;
+        }
+    }
+    return cheapest;
+}
+
+/**
+ * Replays @c schedule. Reports and returns the charge, in fC, spent idle with the modes selected by the power
+ * manager. Each mode used on its own, wherever allowed, must not be cheaper.
+ */
+static uint64_t Replay(const char *name, const STEP_T *schedule)
+{
+    uint64_t selected = 0;
+    uint64_t fixed[POWER_STATE_COUNT] = {0};
+    int used[POWER_STATE_COUNT] = {0};
+    POWER_STATE_T state;
+    POWER_STATE_T fallback;
+    const STEP_T *step;
+    int n;
+
+    for (step = schedule; step->count > 0; step++) {
+        sIdle = step->idle;
+        state = Power_Select(step->deepest);
+        CHECK(state == Cheapest(step->idle, step->deepest));
+        for (n = 0; n < step->count; n++) {
+            selected += Power_GetCost(state, step->idle);
+            used[state]++;
+            for (fallback = POWER_STATE_SLEEP; fallback < POWER_STATE_COUNT; fallback++) {
+                /* A mode that is not allowed, or too slow to leave, falls back to the deepest one that is. */
+                POWER_STATE_T allowed = (fallback < step->deepest) ? fallback : step->deepest;
+                while ((allowed > POWER_STATE_SLEEP) && (step->idle < Latency(allowed))) {
+                    allowed--;
+                }
+                fixed[fallback] += Power_GetCost(allowed, step->idle);
+            }
+        }
+    }
+
+    printf("%-6s %8.1f uC selected (%d Sleep, %d Deep Sleep, %d Deep Power Down); each mode wherever allowed:"
+           " %.1f uC Sleep, %.1f uC Deep Sleep, %.1f uC Deep Power Down\n", name,
+           selected / 1e9, used[POWER_STATE_SLEEP], used[POWER_STATE_DEEPSLEEP], used[POWER_STATE_DEEPPOWERDOWN],
+           fixed[POWER_STATE_SLEEP] / 1e9, fixed[POWER_STATE_DEEPSLEEP] / 1e9, fixed[POWER_STATE_DEEPPOWERDOWN] / 1e9);
+    for (state = POWER_STATE_SLEEP; state < POWER_STATE_COUNT; state++) {
+        CHECK(selected <= fixed[state]);
+    }
+    return selected;
+}
+
+/** Every idle time, from 0 to over an hour, must select the cheapest mode. */
+static void TestSweep(void)
+{
+    uint32_t idle;
+    POWER_STATE_T deepest;
+
+    for (idle = 0; idle < 4000000000u; idle += (idle < 10000) ? 1 : idle / 1000) {
+        sIdle = idle;
+        for (deepest = POWER_STATE_SLEEP; deepest < POWER_STATE_COUNT; deepest++) {
+            CHECK(Power_Select(deepest) == Cheapest(idle, deepest));
+        }
+    }
+}
+
+/** Wake sources and timers that rule out the deeper modes. */
+static void TestRestrictions(void)
+{
+    sIdle = 60000000;
+    CHECK(Power_Select(POWER_STATE_DEEPPOWERDOWN) == POWER_STATE_DEEPPOWERDOWN);
+
+    sFastRunning = true;
+    CHECK(Power_Select(POWER_STATE_DEEPPOWERDOWN) == POWER_STATE_SLEEP);
+    sFastRunning = false;
+
+    Power_SetWakeSources(SYSCON_STARTSOURCE_PIO0_0, false);
+    CHECK(Power_Select(POWER_STATE_DEEPPOWERDOWN) == POWER_STATE_DEEPSLEEP);
+    Power_SetWakeSources(SYSCON_STARTSOURCE_NFC, true);
+    CHECK(Power_Select(POWER_STATE_DEEPPOWERDOWN) == POWER_STATE_DEEPPOWERDOWN);
+
+    Power_SetDeepPowerDown(NULL, false);
+    CHECK(Power_Select(POWER_STATE_DEEPPOWERDOWN) == POWER_STATE_DEEPSLEEP);
+    Power_SetDeepPowerDown(DpdCb, false);
+}
+
+/** Deep Power Down that is refused by the application, or not entered because an interrupt is pending. */
+static void TestIdle(void)
+{
+    sIdle = 60000000;
+
+    /* Refused: Deep Sleep instead. */
+    sDpdAllowed = false;
+    CHECK(Power_Idle(POWER_STATE_DEEPPOWERDOWN) == POWER_STATE_DEEPSLEEP);
+    CHECK((sDpdCalls == 1) && (sDpdEntries == 0) && (sDeepSleepEntries == 1));
+    CHECK(sEnergyState == ENERGY_STATE_ACTIVE);
+
+    /* Not entered: back to the caller right away, active, with the PMU batch ended. No other mode is tried. */
+    sDpdAllowed = true;
+    CHECK(Power_Idle(POWER_STATE_DEEPPOWERDOWN) == POWER_STATE_DEEPPOWERDOWN);
+    CHECK((sDpdCalls == 2) && (sDpdEntries == 1) && (sDeepSleepEntries == 1) && (sSleepEntries == 0));
+    CHECK(sEnergyState == ENERGY_STATE_ACTIVE);
+    CHECK(sBatchDepth == 0);
+
+    /* Short idle periods never get to the callback. */
+    sIdle = 50;
+    CHECK(Power_Idle(POWER_STATE_DEEPPOWERDOWN) == POWER_STATE_SLEEP);
+    CHECK((sDpdCalls == 2) && (sSleepEntries == 1));
+    CHECK(sEnergyState == ENERGY_STATE_ACTIVE);
+}
+
+/* ------------------------------------------------------------------------- */
+
+int main(void)
+{
+    Power_Init();
+    Power_SetWakeSources(SYSCON_STARTSOURCE_NFC, false);
+    Power_SetDeepPowerDown(DpdCb, false);
+
+    TestSweep();
+    TestRestrictions();
+    Replay("demo", sDemoSchedule);
+    Replay("nfc", sNfcSchedule);
+    TestIdle();
+
+    if (sFailures) {
+        printf("power: %d checks failed\n", sFailures);
+        return 1;
+    }
+    printf("power: all tests passed\n");
+    return 0;
+}
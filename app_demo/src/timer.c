@@ -14,6 +14,78 @@
 #include "chip.h"
 #include "timer.h"
 
+/** The frequency of the 32-bit timer, after prescaling: it counts microseconds. */
+#define FAST_FREQUENCY 1000000
+
+/** The match register of the 32-bit timer used for the first timer of the fast queue. */
+#define FAST_MATCH 0
+
+/** The match register of the 32-bit timer used to count its wrap-arounds: it matches when the counter becomes 0. */
+#define WRAP_MATCH 1
+
+/** Values for #TIMER_T.state */
+#define STATE_STOPPED 0
+#define STATE_FAST 1
+#define STATE_SLOW 2
+
+/* -------------------------------------------------------------------------------- */
+
+static bool Before(uint32_t a, uint32_t b);
+static void Insert(TIMER_T **ppHead, TIMER_T *pTimer);
+static void Remove(TIMER_T **ppHead, TIMER_T *pTimer);
+static TIMER_T *Take(TIMER_T **ppHead, uint32_t now);
+static void ArmFast(void);
+static void ArmSlow(uint32_t now);
+static void Reload(uint32_t now, uint32_t expiry);
+static void Start(TIMER_T *pTimer, uint32_t ms, uint32_t slack, TIMER_CB_T cb, uint32_t context, bool slow);
+static void Count(int expiries);
+static void HostTimeoutCb(uint32_t context);
+static void MeasurementTimeoutCb(uint32_t context);
+static uint64_t GetCount(void);
+
+/* -------------------------------------------------------------------------------- */
+
+/** Running timers on the 32-bit timer, sorted on latest expiry. Times are values of the 32-bit timer. */
+static TIMER_T *spFast = NULL;
+
+/** Running timers on the RTC, sorted on latest expiry. Times are values of the RTC "time up-counter". */
+static TIMER_T *spSlow = NULL;
+
+/** @c true while the RTC "wake-up down-counter" is enabled. */
+static bool sSlowEnabled = false;
+
+/** @c true while the RTC "wake-up down-counter" is counting down to @c sSlowArmedExpiry. */
+static bool sSlowCounting = false;
+
+/** The time programmed in the RTC "wake-up down-counter", if @c sSlowCounting. Avoids needless slow RTC writes. */
+static uint32_t sSlowArmedExpiry;
+
+/**
+ * @c true until the RTC "wake-up down-counter" is programmed for the first time after #Timer_Init: a wake-up before
+ * that was armed before a reset or a Deep Power Down.
+ */
+static bool sSlowFromReset = false;
+
+static TIMER_T sHostTimer;
+static TIMER_T sMeasurementTimer;
+static volatile bool sHostTimeoutInterruptFired = false;
+
+/** The number of wrap-arounds of the 32-bit timer: the upper 32 bits of the extended counter. */
+static uint32_t sWraps = 0;
+
+/** Added to the extended counter to obtain #Timer_GetTimestamp. */
+static uint64_t sTimestampOffset = 0;
+
+/** The number of wake-ups and expiries since #Timer_ResetStats, see #TIMER_STATS_T. */
+static uint32_t sWakeups = 0;
+static uint32_t sExpiries = 0;
+
+/** The value of #Timer_GetTimestamp at the last call to #Timer_ResetStats. */
+static uint64_t sStatsStart = 0;
+
+/** The last interval used for #Timer_StartMeasurementTimeout, in seconds. */
+static int sMeasurementSeconds = 0;
+
 /**
  * @c false when the timer is stopped or when the RTC_IRQn interrupt wasn't fired after being started (again).
  * @c true when the timer was started (again) and the interrupt was fired.
@@ -22,68 +94,492 @@ static volatile bool sMeasurementTimeoutInterruptFired = false;
 
 /* -------------------------------------------------------------------------------- */
 
+/** Compares two timer values, taking wrap-around into account. */
+static bool Before(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) < 0;
+}
+
+/**
+ * Inserts on latest expiry: the first timer of a queue determines when the hardware must fire. Timers with the same
+ * latest expiry expire in the order they were started.
+ */
+static void Insert(TIMER_T **ppHead, TIMER_T *pTimer)
+{
+    while ((*ppHead != NULL) && !Before(pTimer->latest, (*ppHead)->latest)) {
+        ppHead = &(*ppHead)->pNext;
+    }
+    pTimer->pNext = *ppHead;
+    *ppHead = pTimer;
+}
+
+static void Remove(TIMER_T **ppHead, TIMER_T *pTimer)
+{
+    while (*ppHead != NULL) {
+        if (*ppHead == pTimer) {
+            *ppHead = pTimer->pNext;
+            break;
+        }
+        ppHead = &(*ppHead)->pNext;
+    }
+    pTimer->pNext = NULL;
+    pTimer->state = STATE_STOPPED;
+}
+
+/**
+ * Removes the first timer of which the window has opened. Coalescing happens here: whichever timer caused the
+ * wake-up, all timers of which the expiry has passed are taken, also those that could still have waited.
+ * @param ppHead : The queue to take the timer from.
+ * @param now : The current time, in the unit of the queue.
+ * @return The timer taken from the queue, or @c NULL if no timer has expired yet.
+ * @pre Interrupts are disabled.
+ */
+static TIMER_T *Take(TIMER_T **ppHead, uint32_t now)
+{
+    TIMER_T *pTimer;
+
+    for (; *ppHead != NULL; ppHead = &(*ppHead)->pNext) {
+        pTimer = *ppHead;
+        if (!Before(now, pTimer->expiry)) {
+            *ppHead = pTimer->pNext;
+            pTimer->pNext = NULL;
+            pTimer->state = STATE_STOPPED;
+            return pTimer;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Programs the match register for the first timer in the fast queue.
+ * @pre Interrupts are disabled.
+ */
+static void ArmFast(void)
+{
+    if (spFast == NULL) {
+        Chip_TIMER_MatchDisableInt(LPC_TIMER32_0, FAST_MATCH);
+    }
+    else {
+        Chip_TIMER_SetMatch(LPC_TIMER32_0, FAST_MATCH, spFast->latest);
+        Chip_TIMER_MatchEnableInt(LPC_TIMER32_0, FAST_MATCH);
+        /* A match only fires on equality: if the counter already passed the expiry, the match would only fire after
+         * a full wrap-around of the counter. */
+        if (!Before(Chip_TIMER_ReadCount(LPC_TIMER32_0), spFast->latest)) {
+            NVIC_SetPendingIRQ(CT32B0_IRQn);
+        }
+    }
+}
+
+/**
+ * Programs the RTC "wake-up down-counter" for the first timer in the slow queue.
+ * Each RTC register access may take up to 100 us: nothing is written when the first timer did not change.
+ * @param now : The current value of the RTC "time up-counter".
+ * @pre Interrupts are disabled.
+ */
+static void ArmSlow(uint32_t now)
+{
+    if (spSlow != NULL) {
+        if (!sSlowCounting || (sSlowArmedExpiry != spSlow->latest)) {
+            Reload(now, spSlow->latest);
+        }
+    }
+    else if (sMeasurementTimeoutInterruptFired) {
+        /* The main thread has not yet acted upon an expired measurement timeout. When it fails to check the flag
+         * before going to Deep Power Down, the IC would not wake up anymore. To prevent this, a new short timeout is
+         * unconditionally programmed, to ensure the RTC is never stopped: the next correct time to make a next
+         * measurement will be set by a new call to Timer_StartMeasurementTimeout, overruling this. */
+        if (!sSlowCounting) {
+            Reload(now, now + 1); /* Any small value will do. */
+        }
+    }
+    else if (sSlowEnabled) {
+        Chip_RTC_Wakeup_SetControl(LPC_RTC, RTC_WAKEUPCTRL_DISABLE);
+        sSlowEnabled = false;
+        sSlowCounting = false;
+    }
+}
+
+/**
+ * Starts the RTC "wake-up down-counter".
+ * @param now : The current value of the RTC "time up-counter".
+ * @param expiry : The value of the RTC "time up-counter" at which to wake up.
+ * @pre Interrupts are disabled.
+ */
+static void Reload(uint32_t now, uint32_t expiry)
+{
+    int32_t ticks = (int32_t)(expiry - now);
+
+    if (!sSlowEnabled) {
+        Chip_RTC_Wakeup_SetControl(LPC_RTC, (RTC_WAKEUPCTRL_T)(RTC_WAKEUPCTRL_ENABLE | RTC_WAKEUPCTRL_AUTO));
+        sSlowEnabled = true;
+    }
+    Chip_RTC_Wakeup_SetReload(LPC_RTC, (ticks < 1) ? 1 : ticks);
+    sSlowCounting = true;
+    sSlowArmedExpiry = expiry;
+    sSlowFromReset = false;
+}
+
+/**
+ * Inserts a timer in the fast or slow queue.
+ * @param slow : @c true to use the RTC, even for short intervals: only then the timer survives Deep Power Down.
+ */
+static void Start(TIMER_T *pTimer, uint32_t ms, uint32_t slack, TIMER_CB_T cb, uint32_t context, bool slow)
+{
+    uint32_t primask;
+    uint32_t now = 0;
+
+    ASSERT((pTimer != NULL) && (cb != NULL));
+    ASSERT((ms > 0) && (ms < 0x80000000 / 1000) && (slack < 0x80000000 / 1000 - ms));
+    if (slow) {
+        now = (uint32_t)Chip_RTC_Time_GetValue(LPC_RTC); /* Read before disabling interrupts: this takes long. */
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    Timer_Stop(pTimer);
+    pTimer->cb = cb;
+    pTimer->context = context;
+    if (slow) {
+        pTimer->expiry = now + ((ms + 999) / 1000);
+        pTimer->latest = pTimer->expiry + (slack / 1000);
+        pTimer->state = STATE_SLOW;
+        Insert(&spSlow, pTimer);
+        ArmSlow(now);
+    }
+    else {
+        pTimer->expiry = Chip_TIMER_ReadCount(LPC_TIMER32_0) + (ms * (FAST_FREQUENCY / 1000));
+        pTimer->latest = pTimer->expiry + (slack * (FAST_FREQUENCY / 1000));
+        pTimer->state = STATE_FAST;
+        Insert(&spFast, pTimer);
+        if (spFast == pTimer) {
+            ArmFast();
+        }
+    }
+    __set_PRIMASK(primask);
+}
+
+/* -------------------------------------------------------------------------------- */
+
+/**
+ * Updates the statistics after an interrupt.
+ * @param expiries : The number of timers that expired during the interrupt.
+ */
+static void Count(int expiries)
+{
+    if (expiries > 0) {
+        sWakeups++;
+        sExpiries += (uint32_t)expiries;
+    }
+}
+
+/* -------------------------------------------------------------------------------- */
+
+static void HostTimeoutCb(uint32_t context)
+{
+    (void)context;
+    sHostTimeoutInterruptFired = true;
+}
+
+static void MeasurementTimeoutCb(uint32_t context)
+{
+    (void)context;
+    sMeasurementTimeoutInterruptFired = true;
+}
+
+/**
+ * Reads the 32-bit timer, extended to 64 bits.
+ * @pre Interrupts are disabled.
+ */
+static uint64_t GetCount(void)
+{
+    uint32_t wraps = sWraps;
+    uint32_t count = Chip_TIMER_ReadCount(LPC_TIMER32_0);
+
+    if (Chip_TIMER_MatchPending(LPC_TIMER32_0, WRAP_MATCH)) {
+        /* A wrap-around not yet counted by the interrupt handler: the counter may have been read just before it. */
+        count = Chip_TIMER_ReadCount(LPC_TIMER32_0);
+        wraps++;
+    }
+    return ((uint64_t)wraps << 32) | count;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void CT32B0_IRQHandler(void)
+{
+    TIMER_T *pTimer;
+    uint32_t primask;
+    int expiries = 0;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (Chip_TIMER_MatchPending(LPC_TIMER32_0, WRAP_MATCH)) {
+        /* Together, without interruption: GetCount checks the flag to detect uncounted wrap-arounds. */
+        sWraps++;
+        Chip_TIMER_ClearMatch(LPC_TIMER32_0, WRAP_MATCH);
+    }
+    __set_PRIMASK(primask);
+
+    Chip_TIMER_ClearMatch(LPC_TIMER32_0, FAST_MATCH);
+    do {
+        /* Take one expired timer at a time: a callback may start or stop other timers. */
+        primask = __get_PRIMASK();
+        __disable_irq();
+        pTimer = Take(&spFast, Chip_TIMER_ReadCount(LPC_TIMER32_0));
+        if (pTimer == NULL) {
+            ArmFast();
+        }
+        __set_PRIMASK(primask);
+
+        if (pTimer != NULL) {
+            pTimer->cb(pTimer->context);
+            expiries++;
+        }
+    } while (pTimer != NULL);
+    Count(expiries);
+}
+
+/* -------------------------------------------------------------------------------- */
+
 void RTC_IRQHandler(void)
 {
-    RTC_INT_T status = Chip_RTC_Int_GetRawStatus(LPC_RTC);
+    TIMER_T *pTimer;
+    uint32_t primask;
+    uint32_t now;
+    bool slowExpired = false;
+    int expiries = 0;
+    /* The interrupt mask is a shadow copy in the RTC driver, but the status must be read: a stale pending interrupt,
+     * or an interrupt raised before its mask was cleared, must not be taken for an expired wake-up down-counter. */
+    RTC_INT_T status = Chip_RTC_Int_GetRawStatus(LPC_RTC) & Chip_RTC_Int_GetEnabledMask(LPC_RTC);
     Chip_RTC_Int_ClearRawStatus(LPC_RTC, status);
 
     if (status & RTC_INT_WAKEUP) {
-        /* The down counter of the RTC does not automatically reload. In this handler, only a flag is stored, that the
-         * main thread has to check and act upon. When the flash is checked, it will then call ExecuteMeasurementMode
-         * Inside that function, the RTC is reloaded with the correct seconds interval. This is not done here, since
-         * the IC might 'wake up' from Deep Power Down due to an expiring RTC, when this interrupt handler is not
-         * called.
-         * When the main thread fails to check the flag before going to Deep Power Down, he will not wake up anymore
-         * due to RTC. To prevent this, we unconditionally program a new short timeout now, to ensure the RTC is never
-         * stopped: the next correct time to make a next measurement will be set in ExecuteMeasurementMode, overruling
-         * this.
-         */
-        Chip_RTC_Wakeup_SetReload(LPC_RTC, 1); /* Any small value will do. */
-        sMeasurementTimeoutInterruptFired = true;
+        now = (uint32_t)Chip_RTC_Time_GetValue(LPC_RTC);
+        sSlowCounting = false; /* The AUTO bit only restarts the counter when a new reload value is written. */
+        do {
+            /* Timers on the 32-bit timer of which the window has opened are taken along: the CPU is awake anyway. */
+            primask = __get_PRIMASK();
+            __disable_irq();
+            pTimer = Take(&spSlow, now);
+            if (pTimer != NULL) {
+                slowExpired = true;
+            }
+            else {
+                pTimer = Take(&spFast, Chip_TIMER_ReadCount(LPC_TIMER32_0));
+                if (pTimer != NULL) {
+                    ArmFast();
+                }
+            }
+            if (pTimer == NULL) {
+                if (!slowExpired && sSlowFromReset) {
+                    /* This wake-up was armed before a Deep Power Down, where all timers but the RTC were lost.
+                     * Only the measurement timeout is meant to survive. */
+                    sMeasurementTimeoutInterruptFired = true;
+                }
+                ArmSlow(now);
+            }
+            __set_PRIMASK(primask);
+
+            if (pTimer != NULL) {
+                pTimer->cb(pTimer->context);
+                expiries++;
+            }
+        } while (pTimer != NULL);
+        Count(expiries);
     }
 }
 
 /* -------------------------------------------------------------------------------- */
 
+/** The Start Logic interrupt of the RTC: only enabled to wake up the IC from Deep Sleep. */
+void RTCPWREQ_IRQHandler(void)
+{
+    Chip_SysCon_StartLogic_ClearStatus(SYSCON_STARTSOURCE_RTC);
+}
+
+/* -------------------------------------------------------------------------------- */
+
 void Timer_Init(void)
 {
+    uint32_t primask;
+
     /* RTC timer: down counter may be already running or have been expired just now. Ensure interrupts arrive. */
     Chip_RTC_Init(LPC_RTC);
+    sSlowEnabled = (Chip_RTC_Wakeup_GetControl(LPC_RTC) & RTC_WAKEUPCTRL_ENABLE) != 0;
+    sSlowCounting = false;
+    sSlowFromReset = true;
     Chip_RTC_Int_SetEnabledMask(LPC_RTC, RTC_INT_WAKEUP);
+    Chip_SysCon_StartLogic_SetEnabledMask((SYSCON_STARTSOURCE_T)(Chip_SysCon_StartLogic_GetEnabledMask()
+            | SYSCON_STARTSOURCE_RTC));
+    Chip_SysCon_StartLogic_ClearStatus(SYSCON_STARTSOURCE_RTC);
     sMeasurementTimeoutInterruptFired = false;
+    NVIC_EnableIRQ(RTCPWREQ_IRQn);
     NVIC_EnableIRQ(RTC_IRQn);
 
-    /* 16-bit timer: nothing to do. Started on request only. */
-    /* 32-bit timer: nothing to do. Started on request only. */
+    /* 32-bit timer: free running time base. Besides the wrap-around match, only the match interrupts of running timers
+     * are enabled. */
+    ASSERT(Chip_Clock_System_GetClockFreq() >= FAST_FREQUENCY);
+    Chip_TIMER_Init(LPC_TIMER32_0, CLOCK_PERIPHERAL_32TIMER0);
+    Chip_TIMER_Disable(LPC_TIMER32_0);
+    LPC_TIMER32_0->MCR = 0;
+    Chip_TIMER_PrescaleSet(LPC_TIMER32_0, (uint32_t)(Chip_Clock_System_GetClockFreq() / FAST_FREQUENCY) - 1);
+    Chip_TIMER_Reset(LPC_TIMER32_0);
+    Chip_TIMER_SetMatch(LPC_TIMER32_0, WRAP_MATCH, 0);
+    primask = __get_PRIMASK();
+    __disable_irq();
+    spFast = NULL;
+    spSlow = NULL;
+    sWraps = 0;
+    sTimestampOffset = 0;
+    Chip_TIMER_Enable(LPC_TIMER32_0);
+    while (Chip_TIMER_ReadCount(LPC_TIMER32_0) == 0) {
+        ; /* Wait at most 1 us, to not count the counter being 0 right after the reset as a wrap-around. */
+    }
+    Chip_TIMER_ClearMatch(LPC_TIMER32_0, FAST_MATCH);
+    Chip_TIMER_ClearMatch(LPC_TIMER32_0, WRAP_MATCH);
+    Chip_TIMER_MatchEnableInt(LPC_TIMER32_0, WRAP_MATCH);
+    __set_PRIMASK(primask);
+    NVIC_EnableIRQ(CT32B0_IRQn);
+
+    Timer_SyncTimestamp();
+    Timer_ResetStats();
 }
 
 /* -------------------------------------------------------------------------------- */
 
-void Timer_StartMeasurementTimeout(int seconds)
+void Timer_Start(TIMER_T *pTimer, uint32_t ms, TIMER_CB_T cb, uint32_t context)
+{
+    Start(pTimer, ms, 0, cb, context, ms >= TIMER_RTC_THRESHOLD);
+}
+
+void Timer_StartWithSlack(TIMER_T *pTimer, uint32_t ms, uint32_t slack, TIMER_CB_T cb, uint32_t context)
+{
+    Start(pTimer, ms, slack, cb, context, ms >= TIMER_RTC_THRESHOLD);
+}
+
+void Timer_Stop(TIMER_T *pTimer)
+{
+    uint32_t primask;
+
+    ASSERT(pTimer != NULL);
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (pTimer->state == STATE_FAST) {
+        Remove(&spFast, pTimer);
+        ArmFast();
+    }
+    else if (pTimer->state == STATE_SLOW) {
+        Remove(&spSlow, pTimer);
+        /* The RTC is not reprogrammed: an early wake-up is harmless, and cheaper than two slow RTC accesses now. */
+    }
+    __set_PRIMASK(primask);
+}
+
+bool Timer_IsRunning(const TIMER_T *pTimer)
+{
+    ASSERT(pTimer != NULL);
+    return pTimer->state != STATE_STOPPED;
+}
+
+bool Timer_IsFastRunning(void)
+{
+    return spFast != NULL;
+}
+
+uint32_t Timer_GetIdleTime(void)
+{
+    uint32_t idle = 0xFFFFFFFF;
+    int32_t fast;
+    int64_t slow;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (spFast != NULL) {
+        fast = (int32_t)(spFast->latest - Chip_TIMER_ReadCount(LPC_TIMER32_0));
+        idle = (fast < 0) ? 0 : (uint32_t)fast;
+    }
+    if (spSlow != NULL) {
+        slow = (int64_t)(((uint64_t)spSlow->latest * FAST_FREQUENCY) - (GetCount() + sTimestampOffset));
+        if (slow < (int64_t)idle) {
+            idle = (slow < 0) ? 0 : (uint32_t)slow;
+        }
+    }
+    __set_PRIMASK(primask);
+    return idle;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void Timer_GetStats(TIMER_STATS_T *pStats)
+{
+    uint64_t elapsed;
+    uint32_t primask;
+
+    ASSERT(pStats != NULL);
+    primask = __get_PRIMASK();
+    __disable_irq();
+    pStats->wakeups = sWakeups;
+    pStats->expiries = sExpiries;
+    elapsed = GetCount() + sTimestampOffset - sStatsStart;
+    __set_PRIMASK(primask);
+
+    /* Rarely called: the 64-bit divisions are acceptable here. */
+    elapsed = elapsed / FAST_FREQUENCY;
+    pStats->seconds = (elapsed > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32_t)elapsed;
+    if (elapsed == 0) {
+        elapsed = 1;
+    }
+    pStats->wakeupsPerHour = (uint32_t)(((uint64_t)pStats->wakeups * 3600) / elapsed);
+    pStats->expiriesPerHour = (uint32_t)(((uint64_t)pStats->expiries * 3600) / elapsed);
+}
+
+void Timer_ResetStats(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    sWakeups = 0;
+    sExpiries = 0;
+    sStatsStart = GetCount() + sTimestampOffset;
+    __set_PRIMASK(primask);
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void Timer_StartHostTimeout(int seconds)
 {
-    Chip_RTC_Wakeup_SetControl(LPC_RTC, RTC_WAKEUPCTRL_DISABLE);
+    ASSERT(seconds > 0);
+    sHostTimeoutInterruptFired = false;
+    Timer_Start(&sHostTimer, (uint32_t)seconds * 1000, HostTimeoutCb, 0);
+}
+
+void Timer_StopHostTimeout(void)
+{
+    Timer_Stop(&sHostTimer);
+    sHostTimeoutInterruptFired = false;
+}
+
+bool Timer_CheckHostTimeout(void)
+{
+    return sHostTimeoutInterruptFired;
+}
+
+/* -------------------------------------------------------------------------------- */
 
+void Timer_StartMeasurementTimeout(int seconds)
+{
     sMeasurementTimeoutInterruptFired = false;
     if (!seconds) {
-        seconds = Chip_RTC_Wakeup_GetReload(LPC_RTC);
+        seconds = sMeasurementSeconds;
     }
     if (!seconds) {
         seconds = 42; /* 42 seems a sensible default value. */
     }
-
-    Chip_RTC_Wakeup_SetControl(LPC_RTC, (RTC_WAKEUPCTRL_T)(RTC_WAKEUPCTRL_ENABLE | RTC_WAKEUPCTRL_AUTO));
-    Chip_RTC_Wakeup_SetReload(LPC_RTC, seconds);
-    Chip_SysCon_StartLogic_SetEnabledMask(SYSCON_STARTSOURCE_RTC);
-    Chip_SysCon_StartLogic_ClearStatus(SYSCON_STARTSOURCE_RTC);
-    NVIC_EnableIRQ(RTC_IRQn);
-    Chip_RTC_Int_SetEnabledMask(LPC_RTC, RTC_INT_WAKEUP);
+    sMeasurementSeconds = seconds;
+    Start(&sMeasurementTimer, (uint32_t)seconds * 1000, 0, MeasurementTimeoutCb, 0, true);
 }
 
 void Timer_StopMeasurementTimeout(void)
 {
-    Chip_RTC_Wakeup_SetControl(LPC_RTC, RTC_WAKEUPCTRL_DISABLE);
-    NVIC_DisableIRQ(RTC_IRQn);
-    Chip_RTC_Int_SetEnabledMask(LPC_RTC, RTC_INT_NONE);
+    Timer_Stop(&sMeasurementTimer);
     sMeasurementTimeoutInterruptFired = false;
 }
 
@@ -92,3 +588,56 @@ bool Timer_CheckMeasurementTimeout(void)
     return sMeasurementTimeoutInterruptFired;
 }
 
+/* -------------------------------------------------------------------------------- */
+
+void Timer_StartFreeRunning(void)
+{
+    /* Nothing to do: the 32-bit timer is running since Timer_Init. */
+}
+
+void Timer_StopFreeRunning(void)
+{
+    /* Nothing to do: the 32-bit timer is used by the software timers. */
+}
+
+uint32_t Timer_GetFreeRunning(void)
+{
+    return (uint32_t)Timer_GetTimestamp();
+}
+
+uint64_t Timer_GetTimestamp(void)
+{
+    uint64_t timestamp;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    timestamp = GetCount() + sTimestampOffset;
+    __set_PRIMASK(primask);
+    return timestamp;
+}
+
+void Timer_SyncTimestamp(void)
+{
+    uint64_t rtc = (uint64_t)(uint32_t)Chip_RTC_Time_GetValue(LPC_RTC) * FAST_FREQUENCY;
+    uint64_t timestamp;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    timestamp = GetCount() + sTimestampOffset;
+    if (timestamp < rtc) {
+        sTimestampOffset += rtc - timestamp;
+    }
+    __set_PRIMASK(primask);
+}
+
+void Timer_UpdateClock(void)
+{
+    uint32_t primask;
+
+    ASSERT(Chip_Clock_System_GetClockFreq() >= FAST_FREQUENCY);
+    primask = __get_PRIMASK();
+    __disable_irq();
+    Chip_TIMER_PrescaleSet(LPC_TIMER32_0, (uint32_t)(Chip_Clock_System_GetClockFreq() / FAST_FREQUENCY) - 1);
+    /* A prescale counter above the new prescale value would only be cleared when it wraps around. */
+    LPC_TIMER32_0->PC = 0;
+    __set_PRIMASK(primask);
+    Timer_SyncTimestamp();
+}
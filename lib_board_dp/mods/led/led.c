@@ -15,8 +15,54 @@
 #include "board.h"
 #include "led/led.h"
 
+#if LED_COUNT > 12
+    #error There are only 12 GPIO pins.
+#endif
+
 #if LED_COUNT
-static LED_PROPERTIES_T sLeds[LED_COUNT] = LED_PROPERTIES;
+static const LED_PROPERTIES_T sLeds[LED_COUNT] = LED_PROPERTIES;
+
+/** The GPIO pins driving an active low LED: XOR-ed with the LED states to obtain the pin states. */
+static uint32_t sActiveLow;
+
+/**
+ * The GPIO pins driving each combination of LEDs, per group of 4 LEDs: sPins[g][m] holds the pins of the LEDs
+ * LED_(4 * g + b) for each bit b set in m. Filled in by LED_Init.
+ */
+static uint16_t sPins[(LED_COUNT + 3) / 4][16];
+
+static uint32_t ToPins(int leds);
+static int FromPins(uint32_t pins);
+
+/* -------------------------------------------------------------------------
+ * Private functions
+ * ------------------------------------------------------------------------- */
+
+/** Maps a mask of LEDs to the mask of the GPIO pins driving them. */
+static uint32_t ToPins(int leds)
+{
+    uint32_t pins = sPins[0][leds & 0xF];
+#if LED_COUNT > 4
+    pins |= sPins[1][(leds >> 4) & 0xF];
+#endif
+#if LED_COUNT > 8
+    pins |= sPins[2][(leds >> 8) & 0xF];
+#endif
+    return pins;
+}
+
+/** Maps a mask of GPIO pins to the mask of the LEDs they drive. */
+static int FromPins(uint32_t pins)
+{
+    int leds = 0;
+
+    for (int n = 0; n < LED_COUNT; n++) {
+        if (pins & (1u << sLeds[n].pin)) {
+            leds |= LED_(n);
+        }
+    }
+    return leds;
+}
 #endif
 
 /* -------------------------------------------------------------------------
@@ -26,9 +72,25 @@ static LED_PROPERTIES_T sLeds[LED_COUNT] = LED_PROPERTIES;
 void LED_Init(void)
 {
 #if LED_COUNT
+    sActiveLow = 0;
     for (int n = 0; n < LED_COUNT; n++) {
+        ASSERT(sLeds[n].port == 0); /* All LEDs are updated with a single masked write to the DATA register. */
         Chip_IOCON_SetPinConfig(LPC_IOCON, sLeds[n].pio, IOCON_FUNC_0 | IOCON_RMODE_INACT);
         Chip_GPIO_SetPinDIROutput(LPC_GPIO, sLeds[n].port, sLeds[n].pin);
+        if (!sLeds[n].polarity) {
+            sActiveLow |= 1u << sLeds[n].pin;
+        }
+    }
+    for (int m = 0; m < 16; m++) {
+        for (int g = 0; g < (LED_COUNT + 3) / 4; g++) {
+            uint32_t pins = 0;
+            for (int n = 4 * g; (n < 4 * g + 4) && (n < LED_COUNT); n++) {
+                if (m & (1 << (n % 4))) {
+                    pins |= 1u << sLeds[n].pin;
+                }
+            }
+            sPins[g][m] = (uint16_t)pins;
+        }
     }
     LED_Off(LED_ALL);
 #endif
@@ -37,24 +99,16 @@ void LED_Init(void)
 void LED_SetState(int leds, int states)
 {
 #if LED_COUNT
-    for (int n = 0; n < LED_COUNT; n++) {
-        if (leds & LED_(n)) {
-          Chip_GPIO_SetPinState(LPC_GPIO, sLeds[n].port, sLeds[n].pin, ((bool)((states >> n) & 1)) == sLeds[n].polarity);
-        }
-    }
+    /* Only the pins in the address mask are written. */
+    LPC_GPIO->DATA[ToPins(leds)] = ToPins(states) ^ sActiveLow;
 #endif
 }
 
 int LED_GetState(int leds)
 {
 #if LED_COUNT
-    int result = 0;
-    for (int n = 0; n < LED_COUNT; n++) {
-        if (leds & LED_(n)) {
-            result |= (Chip_GPIO_GetPinState(LPC_GPIO, sLeds[n].port, sLeds[n].pin) == sLeds[n].polarity) << n;
-        }
-    }
-    return result;
+    uint32_t pins = ToPins(leds);
+    return FromPins((LPC_GPIO->DATA[pins] ^ sActiveLow) & pins);
 #else
     return 0;
 #endif
@@ -72,5 +126,7 @@ void LED_Off(int leds)
 
 void LED_Toggle(int leds)
 {
-    LED_SetState(leds, ~LED_GetState(leds));
+#if LED_COUNT
+    Chip_GPIO_SetPortToggle(LPC_GPIO, 0, ToPins(leds));
+#endif
 }
@@ -65,6 +65,7 @@ void LED_Init(void);
  * @param states : A mask identifying the new state for the LEDs.
  * @note @c bits set outside #LED_ALL are ignored.
  * @note This is a low-level function, there are also high-level functions: #LED_On, #LED_Off, and #LED_Toggle.
+ * @note All given LEDs change state at once: a single masked write to the GPIO DATA register.
  */
 void LED_SetState(int leds, int states);
 
@@ -97,7 +98,8 @@ void LED_Off(int leds);
  * Toggle all LEDs for the given bits.
  * @param leds : A mask identifying which LEDs to toggle state.
  * @note @c bits set outside #LED_ALL are ignored.
- * @note This function is a shorthand for @code LED_SetState(leds, ~LED_GetState(leds)) @endcode
+ * @note This function has the effect of @code LED_SetState(leds, ~LED_GetState(leds)) @endcode in a single
+ *  read-modify-write of the GPIO DATA register.
  */
 void LED_Toggle(int leds);
 
@@ -27,7 +27,7 @@
  * Used by diversity setting #LED_PROPERTIES
  */
 typedef struct LED_PROPERTIES_S {
-    uint8_t port; /*!< The port number via which the GPIO can access the LED. */
+    uint8_t port; /*!< The port number via which the GPIO can access the LED. Must be 0. */
     uint8_t pin; /*!< The pin number via which the GPIO can access the LED. */
     bool polarity; /*!< The polarity of the LED: @c true if the LED is 'on' when a 1 is written - active high,
         @c false otherwise - active low. */
@@ -142,16 +142,43 @@ void Chip_Clock_System_SetClockFreq(int frequency);
  */
 int Chip_Clock_System_GetClockFreq(void);
 
+/**
+ * The minimum number of System Clock cycles taken by one loop of #Chip_Clock_System_BusyWaitLoops: a NOP, a
+ * decrement and a taken branch, when running from flash without wait states. More cycles per loop - wait states,
+ * non-optimized builds - only make the wait longer.
+ * @note Must be a power of 2: #Chip_Clock_System_BusyWait_us divides by it.
+ */
+#define CLOCK_BUSYWAIT_LOOP_CYCLES 4
+
+/**
+ * Function prototype for a delay that is not required to keep the CPU busy, see #Chip_Clock_System_SetWait.
+ * @param us : number of microseconds to wait
+ */
+typedef void (*CLOCK_WAIT_T)(uint32_t us);
+
+/**
+ * Busy waits for a number of loops of at least #CLOCK_BUSYWAIT_LOOP_CYCLES System Clock cycles each.
+ * @param loops : number of loops to wait. Nothing is done for @c 0.
+ */
+void Chip_Clock_System_BusyWaitLoops(uint32_t loops);
+
 /**
  * Waits the specified amount of time (using instruction counting)
  * @param us : number of microseconds to wait
  * @note This function does not wait if @c us <= 0.
  * @note The wait time shall not exceed 4 000 000 us.
- * @note The wait time is guaranteed to be at least @c us, but it will be somewhat longer.
- * @note Due to the function overhead, for the error to be under 10\% @c us should be at least the equivalent of 512
- *  system ticks. i.e.: @c us > 512 / system clock frequency (MHz)
+ * @note The wait time is guaranteed to be at least @c us, but it will be somewhat longer: more so with flash wait
+ *  states.
+ * @note No division is done at run time: the System Clock frequency is the SFRO frequency divided by a power of 2, and
+ *  the loop count follows from @c us with a multiplication and two shifts. With a constant @c us, the compiler folds
+ *  the multiplication as well.
  */
-void Chip_Clock_System_BusyWait_us(uint32_t us);
+static inline void Chip_Clock_System_BusyWait_us(uint32_t us)
+{
+    ASSERT(us <= 4 * 1000 * 1000);
+    Chip_Clock_System_BusyWaitLoops(((us * (LPC_SFRO_FREQUENCY / 1000000)) / CLOCK_BUSYWAIT_LOOP_CYCLES)
+            >> ((LPC_SYSCON->SYSCLKCTRL >> 1) & 0x7));
+}
 
 /**
  * Waits the specified amount of time (using instruction counting)
@@ -166,6 +193,20 @@ static inline void Chip_Clock_System_BusyWait_ms(int ms)
     Chip_Clock_System_BusyWait_us((uint32_t)(ms*1000));
 }
 
+/**
+ * Installs the function used by #Chip_Clock_System_Wait_us, e.g. a timer based delay that sleeps.
+ * @param wait : @c NULL restores the default, #Chip_Clock_System_BusyWait_us.
+ */
+void Chip_Clock_System_SetWait(CLOCK_WAIT_T wait);
+
+/**
+ * Waits the specified amount of time, without requiring the CPU to be busy meanwhile: the drivers use this for
+ * hardware settle times. Uses the function installed with #Chip_Clock_System_SetWait, if any.
+ * @param us : number of microseconds to wait
+ * @note The wait time shall not exceed 4 000 000 us.
+ */
+void Chip_Clock_System_Wait_us(uint32_t us);
+
 /**
  * Sets the division factor that divides the SFRO into the clock that drives the SPI0 HW block.
  * The supported division factors are 1 and 2-254 (even numbers) and 0 can be used to disable the clock.
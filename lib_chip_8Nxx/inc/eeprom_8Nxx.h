@@ -81,8 +81,10 @@ typedef struct LPC_EEPROM_S {
  * Power and Clock are enabled for EEPROM and for EEPROM controller block.
  * Based upon the configured system clock, the right ref. clock divider is selected.
  * @param pEEPROM : The base address of the EEPROM peripheral on the chip
- * @warning EEPROM driver needs to be re-initialized, if System Clock frequency is changed after initialization.
- * @note EEPROM hardware needs a waiting time after enabling it, #Chip_EEPROM_Init will busy wait for this time,
+ * @warning The ref. clock divider depends on the System Clock frequency: if it is changed after initialization, call
+ *  #Chip_EEPROM_SetClockFreq.
+ * @note EEPROM hardware needs a waiting time after enabling it, #Chip_EEPROM_Init will wait for this time using
+ *  #Chip_Clock_System_Wait_us,
  *  please refer to the user manual for the specific waiting time.
  * @note Before #Chip_EEPROM_Init is called, other API are not usable
  */
@@ -128,6 +130,17 @@ void Chip_EEPROM_Read(LPC_EEPROM_T *pEEPROM, int offset, void *pBuf, int size);
  */
 void Chip_EEPROM_Write(LPC_EEPROM_T *pEEPROM, int offset, void *pBuf, int size);
 
+/**
+ * Adapts the ref. clock divider of the EEPROM controller to a System Clock frequency.
+ * An ongoing flush is waited for first: the ref. clock must not change while a row is being programmed.
+ * @param pEEPROM : The base address of the EEPROM peripheral on the chip
+ * @param frequency : The System Clock frequency in Hz, see #Chip_Clock_System_GetClockFreq.
+ * @note Data written but not yet flushed stays pending.
+ * @note When the System Clock frequency is about to be changed, call this function right before the change with the
+ *  new frequency, with no flush started in between: the resulting ref. clock is then never too fast while programming.
+ */
+void Chip_EEPROM_SetClockFreq(LPC_EEPROM_T *pEEPROM, int frequency);
+
 /**
  * If needed, this function flushes pending data into the EEPROM.
  * To be used only if the user wants to make sure written data is retained, for example before going to sleep.
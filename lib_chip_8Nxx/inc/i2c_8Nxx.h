@@ -212,6 +212,43 @@ uint32_t Chip_I2C_GetClockRate(I2C_ID_T id);
  */
 I2C_STATUS_T Chip_I2C_MasterTransfer(I2C_ID_T id, I2C_XFER_T *xfer);
 
+/**
+ * Starts a master transfer, without waiting for it to end: the asynchronous counterpart of #Chip_I2C_MasterTransfer.
+ * The transfer proceeds in #Chip_I2C_MasterStateHandler, called from the interrupt handler. When it ends, the master
+ * event handler receives #I2C_EVENT_DONE, still in interrupt context: from there, either start the next transfer with
+ * this function - its START condition follows the STOP condition of the previous one without delay - or call
+ * #Chip_I2C_MasterEndXfer.
+ * @param id : I2C peripheral selected (#I2C0)
+ * @param xfer : Pointer to a #I2C_XFER_T structure, see #Chip_I2C_MasterTransfer. Must remain valid until the transfer
+ *  has ended.
+ * @note No #I2C_EVENT_LOCK nor #I2C_EVENT_WAIT events are raised: the caller serializes the transfers.
+ */
+void Chip_I2C_MasterStartXfer(I2C_ID_T id, I2C_XFER_T *xfer);
+
+/**
+ * Starts a sequence of master transfers, without waiting for it to end. The transfers follow each other after a
+ * repeated START condition: the bus is held from the first START condition up to a single STOP condition at the end.
+ * Each transfer may address another slave, and may itself be a write-then-read. The master event handler receives
+ * #I2C_EVENT_DONE once, when the sequence has ended: see #Chip_I2C_MasterStartXfer.
+ * @param id : I2C peripheral selected (#I2C0)
+ * @param xfers : Pointer to an array of @a count #I2C_XFER_T structures, see #Chip_I2C_MasterTransfer. Must remain
+ *  valid until the sequence has ended.
+ * @param count : The number of transfers in the sequence. Must be at least 1.
+ * @note The sequence ends at the first transfer that does not end with #I2C_STATUS_DONE:
+ *  - on a NAK or a bus error, a STOP condition is sent;
+ *  - on an arbitration loss, the bus is left to the other master: no STOP condition is sent.
+ *  .
+ *  The transfers that were not started keep #I2C_STATUS_BUSY.
+ */
+void Chip_I2C_MasterStartSeq(I2C_ID_T id, I2C_XFER_T *xfers, int count);
+
+/**
+ * Ends a series of master transfers started with #Chip_I2C_MasterStartXfer: the I2C block returns to slave mode if a
+ * slave is set up, after the last STOP condition has been sent.
+ * @param id : I2C peripheral selected (#I2C0)
+ */
+void Chip_I2C_MasterEndXfer(I2C_ID_T id);
+
 /**
  * Transmit data to I2C slave using I2C Master mode
  * @param id : I2C peripheral ID (#I2C0)
@@ -199,6 +199,15 @@
  *  the #Chip_PMU_SetRetainedData and #Chip_PMU_GetRetainedData functions. This data section is available to be used by 
  *  the application layer as a simple data container to store data that needs to survive a Deep Power Down.
  *
+ * @anchor pmu_shadow_anchor
+ * @par Shadow copy:
+ *  The driver keeps a copy of the power control register (#LPC_PMU_T.PCON) in RAM. It is read once, at the first
+ *  access after a reset; from then on, reading a setting costs no synchronized register access, and changing a setting
+ *  costs one write instead of a read plus a write. Entering a power mode also needs a single write. The status flags in
+ *  the register are not part of the copy: #Chip_PMU_PowerMode_GetDPDWakeupReason always reads the register.@n
+ *  Several settings can be changed with a single write, by enclosing them in #Chip_PMU_Batch_Begin and
+ *  #Chip_PMU_Batch_Commit. Interrupts are disabled while the copy and the register are updated.
+ *
  * @anchor pmu_syncwait_warning_anchor
  * @warning Each PMU block register read and write performs at least one "wait" period that may take up to 100us to
  *  complete due to hardware synchronization within the module. All the functions in this driver make at least one such
@@ -337,24 +346,28 @@ bool Chip_PMU_Switch_GetVNFC(void);
  * @note The VBAT switch connects the VDDBAT pin to the VDD_ALON power domain.
  * @post The IC will enter the "Off" state if no power is present in the VNFC power domain or switch to VNFC power
  *  otherwise. See @ref pmu_offmode_anchor "Off mode" for more details.
- * @warning This function performs two synchronized register accesses. Impact on runtime performance and other same and
- *  lower-priority contexts should be carefully considered. See @ref pmu_syncwait_warning_anchor "warning" section.
+ * @note Uses the shadow copy of the power control register: see @ref pmu_shadow_anchor "Shadow copy".
+ * @warning This function performs at most one synchronized register access, besides the very first read of the
+ *  register. Impact on runtime performance and other same and lower-priority contexts should be carefully considered.
+ *  See @ref pmu_syncwait_warning_anchor "warning" section.
  */
 void Chip_PMU_Switch_OpenVDDBat(void);
 
 /**
  * Enables/Disables the Brown-Out detection
  * @param enabled : If set to true enables the BOD, otherwise it disables it
- * @warning This function performs two synchronized register accesses. Impact on runtime performance in other same and
- *  lower-priority contexts should be carefully considered. See @ref pmu_syncwait_warning_anchor "warning" section.
+ * @note Uses the shadow copy of the power control register: see @ref pmu_shadow_anchor "Shadow copy".
+ * @warning This function performs at most one synchronized register access, besides the very first read of the
+ *  register. Impact on runtime performance in other same and lower-priority contexts should be carefully considered.
+ *  See @ref pmu_syncwait_warning_anchor "warning" section.
  */
 void Chip_PMU_SetBODEnabled(bool enabled);
 
 /**
  * Gets the Brown-Out detection enabled status
  * @return If true the Brown-Out detection is enabled, otherwise it is disabled
- * @warning This function performs a synchronized register access. Impact on runtime performance in other same and
- * lower-priority contexts should be carefully considered. See @ref pmu_syncwait_warning_anchor "warning" section.
+ * @note Reads the shadow copy of the power control register: no synchronized register access is needed, besides the
+ *  very first read of the register.
  */
 bool Chip_PMU_GetBODEnabled(void);
 
@@ -362,8 +375,10 @@ bool Chip_PMU_GetBODEnabled(void);
  * Enables/Disables the wakeup pin functionality
  * @param enabled : If set to true enables the wakeup pin functionality, otherwise it disables it
  * @note For more details on how the wakeup pin is configured, refer to the "Wakeup Pin" section
- * @warning This function performs two synchronized register accesses. Impact on runtime performance in other same and
- *  lower-priority contexts should be carefully considered. See @ref pmu_syncwait_warning_anchor "warning" section.
+ * @note Uses the shadow copy of the power control register: see @ref pmu_shadow_anchor "Shadow copy".
+ * @warning This function performs at most one synchronized register access, besides the very first read of the
+ *  register. Impact on runtime performance in other same and lower-priority contexts should be carefully considered.
+ *  See @ref pmu_syncwait_warning_anchor "warning" section.
  */
 void Chip_PMU_SetWakeupPinEnabled(bool enabled);
 
@@ -371,11 +386,28 @@ void Chip_PMU_SetWakeupPinEnabled(bool enabled);
  * Gets the wakeup pin functionality enabled status
  * @return If true the wakeup pin functionality is enabled, otherwise it is disabled
  * @note For more details on how the wakeup pin is configured, refer to the "Wakeup Pin" section
- * @warning This function performs a synchronized register access. Impact on runtime performance in other same and
- * lower-priority contexts should be carefully considered. See @ref pmu_syncwait_warning_anchor "warning" section.
+ * @note Reads the shadow copy of the power control register: no synchronized register access is needed, besides the
+ *  very first read of the register.
  */
 bool Chip_PMU_GetWakeupPinEnabled(void);
 
+/**
+ * Starts a batch of power control register changes: #Chip_PMU_SetBODEnabled, #Chip_PMU_SetWakeupPinEnabled and
+ * #Chip_PMU_Switch_OpenVDDBat only update the shadow copy until the matching call to #Chip_PMU_Batch_Commit.
+ * Batches may be nested: only the outermost commit writes the register.
+ * @note The changes of a batch are also written when a power mode is entered. If that power mode returns, the batch
+ *  must still be ended with #Chip_PMU_Batch_Commit, which then has nothing left to write.
+ */
+void Chip_PMU_Batch_Begin(void);
+
+/**
+ * Ends a batch of power control register changes started with #Chip_PMU_Batch_Begin. When this ends the outermost
+ * batch, all changes are written in one synchronized register access; nothing is written when nothing changed.
+ * @warning This function performs at most one synchronized register access. Impact on runtime performance in other same
+ *  and lower-priority contexts should be carefully considered. See @ref pmu_syncwait_warning_anchor "warning" section.
+ */
+void Chip_PMU_Batch_Commit(void);
+
 /**
  * Sets the RTC block clock source. As there is only one possible source, this function effectively allows you to
  * disable all RTC functionality. Gating the clock by providing #PMU_RTC_CLOCKSOURCE_NONE as
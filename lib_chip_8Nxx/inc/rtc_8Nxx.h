@@ -78,6 +78,14 @@
  *  .
  *  See the following examples, along with @ref PMU_LPC8Nxx and @ref SYSCON_LPC8Nxx drivers for more details.
  *
+ * @anchor RTC_SHADOW
+ * @par Shadow copies
+ *  The driver keeps a copy in RAM of the registers that only change when written by software: the calibration value,
+ *  the "wake-up down-counter" control and reload value, and the interrupt mask. Each is read from the RTC block at
+ *  most once after a reset. Reading them back costs no synchronized access, and writing a value they already hold is
+ *  skipped - except where the write itself has an effect, e.g. (re)starting the "wake-up down-counter". Interrupts are
+ *  disabled while a copy and its register are updated.
+ *
  * @anchor RTC_WARNING
  * @warning Each RTC block register read and write performs at least one @c wait period that may take up to 100us
  *  to complete due to hardware synchronization within the module. All the functions in this driver
@@ -172,8 +180,8 @@ void Chip_RTC_SetCalibration(LPC_RTC_T *pRTC, int calibValue);
  * Returns the number of TFRO clock pulses in one RTC 'tick'
  * @param pRTC : The base address of the RTC peripheral on the chip
  * @return 16-bit value indicating the number of TFRO clock pulses in one tick.
- * @warning This function performs a synchronized register access. Impact on runtime performance and
- *  other same and lower-priority contexts should be carefully considered. See @ref RTC_WARNING "warning section".
+ * @note Returns the shadow copy: only the first call after a reset performs a synchronized register access. See
+ *  @ref RTC_SHADOW "shadow copies".
  */
 int Chip_RTC_GetCalibration(LPC_RTC_T *pRTC);
 
@@ -195,7 +203,8 @@ void Chip_RTC_Wakeup_SetControl(LPC_RTC_T * pRTC, RTC_WAKEUPCTRL_T control);
  * @return Bitfield of Control state.
  * @note #RTC_WAKEUPCTRL_START bit is cleared when "wake-up down-counter" reaches zero,
  *  or when a new tick is loaded with #Chip_RTC_Wakeup_SetReload without #RTC_WAKEUPCTRL_AUTO
- * @warning This function performs a synchronized register access. Impact on runtime performance and
+ * @note Returns the shadow copy, unless #RTC_WAKEUPCTRL_START is set: see @ref RTC_SHADOW "shadow copies".
+ * @warning This function may perform a synchronized register access. Impact on runtime performance and
  *  other same and lower-priority contexts should be carefully considered. See @ref RTC_WARNING "warning section".
  */
 RTC_WAKEUPCTRL_T Chip_RTC_Wakeup_GetControl(LPC_RTC_T *pRTC);
@@ -219,8 +228,8 @@ void Chip_RTC_Wakeup_SetReload(LPC_RTC_T *pRTC, int ticks);
  * @param pRTC : The base address of the RTC peripheral on the chip
  * @return 24bit unsigned value of the number of ticks
  * @note This function does not return remaining ticks to a 'wake-up' event.
- * @warning This function performs a synchronized register access. Impact on runtime performance and
- *  other same and lower-priority contexts should be carefully considered. See @ref RTC_WARNING "warning section".
+ * @note Returns the shadow copy: only the first call after a reset performs a synchronized register access. See
+ *  @ref RTC_SHADOW "shadow copies".
  */
 int Chip_RTC_Wakeup_GetReload(LPC_RTC_T *pRTC);
 
@@ -278,8 +287,8 @@ void Chip_RTC_Int_SetEnabledMask(LPC_RTC_T *pRTC, RTC_INT_T mask);
  * Retrieves the RTC interrupt enabled mask.
  * @param pRTC : base address of the RTC block on chip.
  * @return Interrupt enabled mask
- * @warning This function performs a synchronized register access. Impact on runtime performance and
- *  other same and lower-priority contexts should be carefully considered. See @ref RTC_WARNING "warning section".
+ * @note Returns the shadow copy: only the first call after a reset performs a synchronized register access. See
+ *  @ref RTC_SHADOW "shadow copies".
  */
 RTC_INT_T Chip_RTC_Int_GetEnabledMask(LPC_RTC_T *pRTC);
 
@@ -77,7 +77,8 @@
  *  <b> For SSP Master/Slave simultaneous transmission and reception mode (polling): </b>
  *      -# Initialise the SSP driver for master/slave mode as given in @ref SSPInit_anchor "SSP Driver Initialisation"
  *      -# Fill in #Chip_SSP_DATA_SETUP_T structure
- *      -# Use #Chip_SSP_RWFrames_Blocking API to complete the transfer
+ *      -# Use #Chip_SSP_RWFrames_Blocking API to complete the transfer, or - without the setup structure and faster -
+ *         #Chip_SSP_RWFrames8_Blocking or #Chip_SSP_RWFrames16_Blocking
  *      .
  *
  *  @anchor SSPInterrupt_anchor
@@ -187,6 +188,9 @@ typedef enum {
 /** SSP SR bit mask */
 #define SSP_SR_BITMASK  ((uint32_t) (0x1F))
 
+/** The number of frames the TX FIFO, resp. the RX FIFO can hold */
+#define SSP_FIFO_DEPTH  8
+
 /** ICR bit mask */
 #define SSP_ICR_BITMASK ((uint32_t) (0x03))
 
@@ -228,8 +232,8 @@ typedef enum SSP_RAWINTSTATUS {
 
 /** SSP Interrupt clear masks */
 typedef enum SSP_INTCLEAR {
-    SSP_RORIC = 0x0, /**< Overun Mask */
-    SSP_RTIC = 0x1, /**< TimeOut Mask */
+    SSP_RORIC = ((uint32_t)(1 << 0)), /**< Overun Mask */
+    SSP_RTIC = ((uint32_t)(1 << 1)), /**< TimeOut Mask */
     SSP_INT_CLEAR_BITMASK = 0x3 /**< Clear all Mask */
 } SSP_INTCLEAR_T;
 
@@ -570,6 +574,33 @@ uint32_t Chip_SSP_WriteFrames_Blocking(LPC_SSP_T *pSSP, uint8_t *buffer, uint32_
  */
 uint32_t Chip_SSP_ReadFrames_Blocking(LPC_SSP_T *pSSP, uint8_t *buffer, uint32_t buffer_len);
 
+/**
+ * SSP Polling Read/Write of 8-bit frames in blocking mode. Frames are handled in batches of up to #SSP_FIFO_DEPTH:
+ * a batch is written to the TX FIFO in one unrolled sequence, the status register is polled until the SSP is idle,
+ * the overrun flag is checked once, and the batch is read from the RX FIFO in one unrolled sequence.
+ * @param pSSP : The base address of the SSP peripheral on the chip
+ * @param pTx : The frames to send. May be @c NULL: 0xFF is sent instead.
+ * @param pRx : Receives the frames. May be @c NULL: the received frames are dropped.
+ * @param count : The number of frames to transfer
+ * @return The number of frames transferred, or 0 (ERROR) on a receive overrun
+ * @note Between batches, the bus idles for the time the CPU needs to empty and refill the FIFOs. For short
+ *  command/response exchanges, and whenever the CPU is slow compared to the bit rate, this is faster than
+ *  #Chip_SSP_RWFrames_Blocking, which polls the status and the overrun flag for every frame.
+ * @note The SSP must be configured for frames of at most 8 bits.
+ */
+uint32_t Chip_SSP_RWFrames8_Blocking(LPC_SSP_T *pSSP, const uint8_t *pTx, uint8_t *pRx, uint32_t count);
+
+/**
+ * SSP Polling Read/Write of 16-bit frames in blocking mode. See #Chip_SSP_RWFrames8_Blocking.
+ * @param pSSP : The base address of the SSP peripheral on the chip
+ * @param pTx : The frames to send. May be @c NULL: 0xFFFF is sent instead.
+ * @param pRx : Receives the frames. May be @c NULL: the received frames are dropped.
+ * @param count : The number of frames to transfer
+ * @return The number of frames transferred, or 0 (ERROR) on a receive overrun
+ * @note The SSP must be configured for frames of more than 8 bits.
+ */
+uint32_t Chip_SSP_RWFrames16_Blocking(LPC_SSP_T *pSSP, const uint16_t *pTx, uint16_t *pRx, uint32_t count);
+
 /**
  * Initialize the SSP
  * @param pSSP : The base address of the SSP peripheral on the chip
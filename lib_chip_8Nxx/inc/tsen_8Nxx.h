@@ -238,6 +238,8 @@ int Chip_TSen_CelsiusToNative(int celsius, int multiplier);
  * @return The correspondent temperature value in Fahrenheit human readable format
  * @note The output value is a signed 32 bit value. A multiplication factor between 1 and 1024 (inclusive) must be
  *  chosen so that there is no overflow.
+ * @note The conversion is implemented without integer divisions for a multiplier that is a power of two or one of
+ *  10, 100 and 1000. Other multipliers fall back on the (on a Cortex-M0+, slow) library division routine.
  */
 int Chip_TSen_NativeToFahrenheit(int native, int multiplier);
 
@@ -116,13 +116,16 @@ static inline void Chip_WWDT_SetTimeOut(LPC_WWDT_T *pWWDT, uint32_t timeout)
  * @note This is a mandatory step after enabling the WWDT using #Chip_WWDT_SetOption
  * @note If this function isn't called after enabling the WWDT, WWDT will ignore timeout errors and will not generate
  *  a WWDT interrupt or reset the chip.
+ * @note Interrupts are disabled during the feed sequence, and restored afterwards: this function may be called with
+ *  interrupts disabled.
  */
 static inline void Chip_WWDT_Feed(LPC_WWDT_T *pWWDT)
 {
+    uint32_t primask = __get_PRIMASK();
     __disable_irq();
     pWWDT->FEED = 0xAA;
     pWWDT->FEED = 0x55;
-    __enable_irq();
+    __set_PRIMASK(primask);
 }
 
 /**
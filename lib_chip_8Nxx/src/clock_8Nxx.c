@@ -17,6 +17,9 @@
  * Private types/enumerations/variables
  ****************************************************************************/
 
+/* The function used by Chip_Clock_System_Wait_us, or NULL */
+static CLOCK_WAIT_T Clock_Wait = NULL;
+
 /*****************************************************************************
  * Public types/enumerations/variables
  ****************************************************************************/
@@ -95,33 +98,32 @@ int Chip_Clock_System_GetClockFreq(void)
 }
 
 
-/* Waits the specified amount of time (using instruction counting) */
-void Chip_Clock_System_BusyWait_us(uint32_t us)
+/* Busy waits a number of loops of at least CLOCK_BUSYWAIT_LOOP_CYCLES cycles */
+void Chip_Clock_System_BusyWaitLoops(uint32_t loops)
 {
-    uint32_t ticks_to_wait;
-    uint32_t ns_per_tick;
+    while (loops > 0) {
+        __NOP();
+        loops--;
+    }
+}
 
-    /* Do not wait if us is less than or equal to 0 */
-    if (us == 0) return;
 
-    /* Limit to 4 seconds, otherwise ticks_to_wait will overflow */
-    ASSERT( us <= 4*1000*1000 );
-    
-    /* Calculate the time taken (in ns) per tick */
-    ns_per_tick = (uint32_t)(1000*1000*1000/Chip_Clock_System_GetClockFreq());
+/* Installs the function used by Chip_Clock_System_Wait_us */
+void Chip_Clock_System_SetWait(CLOCK_WAIT_T wait)
+{
+    Clock_Wait = wait;
+}
 
-    /* Calculate the number of ticks to wait */
-    ticks_to_wait = 1000*us/ns_per_tick;
 
-    if(ticks_to_wait >= 480) {
-        /* Subtract the overhead of the function call (found by experiment) */
-        ticks_to_wait -= 480;
+/* Waits the specified amount of time, not necessarily busy */
+void Chip_Clock_System_Wait_us(uint32_t us)
+{
+    if (Clock_Wait != NULL) {
+        Clock_Wait(us);
     }
     else {
-        ticks_to_wait = 0;
+        Chip_Clock_System_BusyWait_us(us);
     }
-    
-    for(uint32_t i = 0; i < ticks_to_wait; i += 5);
 }
 
 
@@ -157,8 +157,6 @@ static void EEPROM_Write(LPC_EEPROM_T *pEEPROM, int offset, void * pBuf, int siz
 /* Initialize and configure the EEPROM peripheral */
 void Chip_EEPROM_Init(LPC_EEPROM_T *pEEPROM)
 {
-    int div;
-
     EEPROM_flushing = false;
     EEPROM_lastWrittenRow = EEPROM_NO_LAST_WRITTEN_ROW;
 
@@ -167,13 +165,26 @@ void Chip_EEPROM_Init(LPC_EEPROM_T *pEEPROM)
     Chip_SysCon_Peripheral_EnablePower(SYSCON_PERIPHERAL_POWER_EEPROM);
 
     /* Wait for the EEPROM to get ready for content access */
-    Chip_Clock_System_BusyWait_us(EEPROM_ACTIVATION_TIME_US);
+    Chip_Clock_System_Wait_us(EEPROM_ACTIVATION_TIME_US);
 
     Chip_SysCon_Peripheral_DeassertReset(SYSCON_PERIPHERAL_RESET_EEPROM);
 
+    Chip_EEPROM_SetClockFreq(pEEPROM, Chip_Clock_System_GetClockFreq());
+}
+
+/* Adapt the ref. clock divider to a System Clock frequency */
+void Chip_EEPROM_SetClockFreq(LPC_EEPROM_T *pEEPROM, int frequency)
+{
+    int div;
+
+    ASSERT(frequency > 0);
+
+    /* The ref. clock must not change while a row is being programmed */
+    WaitUntilReady(pEEPROM);
+
     /* Set clock division factor, making it 'ceiling' by adding (EEPROM_CLOCK_FREQUENCY_HZ - 1).
      * This ensures the resulting ref. clock will not exceed the specified maximum  */
-    div = ( ( Chip_Clock_System_GetClockFreq() + (EEPROM_CLOCK_FREQUENCY_HZ - 1) ) / EEPROM_CLOCK_FREQUENCY_HZ) - 1;
+    div = ((frequency + (EEPROM_CLOCK_FREQUENCY_HZ - 1)) / EEPROM_CLOCK_FREQUENCY_HZ) - 1;
 
     /*If divisor is set to 0, the EEPROM ref. clock is disabled. So ensure it to be at least 1*/
     if (div < 1) {
@@ -190,6 +190,7 @@ struct i2c_interface {
     I2C_EVENTHANDLER_T mEvent; /* Current active Master event handler */
     I2C_EVENTHANDLER_T sEvent; /* Slave transfer events */
     I2C_XFER_T *mXfer; /* Current active xfer pointer */
+    int mMore; /* Number of xfers following mXfer after a repeated start */
     I2C_XFER_T *sXfer; /* Pointer to store xfer when bus is busy */
     uint32_t flags; /* Flags used by I2C master and slave */
 };
@@ -206,6 +207,7 @@ static struct i2c_interface i2c[I2C_NUM_INTERFACE] = { {LPC_I2C,
                                                         Chip_I2C_EventHandler,
                                                         NULL,
                                                         NULL,
+                                                        0,
                                                         NULL,
                                                         0}};
 
@@ -321,7 +323,7 @@ static I2C_SLAVE_ID lookupSlaveIndex(LPC_I2C_T *pI2C, uint8_t slaveAddr)
 }
 
 /* Master transfer state change handler handler */
-int handleMasterXferState(LPC_I2C_T *pI2C, I2C_XFER_T *xfer)
+int handleMasterXferState(LPC_I2C_T *pI2C, I2C_XFER_T *xfer, int more)
 {
     uint32_t cclr = I2C_CON_FLAGS;
 
@@ -335,7 +337,17 @@ int handleMasterXferState(LPC_I2C_T *pI2C, I2C_XFER_T *xfer)
         case 0x18: /* SLA+W sent and ACK received */
         case 0x28: /* DATA sent and ACK received */
             if (!xfer->txSz) {
-                cclr &= ~(xfer->rxSz ? I2C_CON_STA : I2C_CON_STO);
+                if (xfer->rxSz) {
+                    cclr &= ~I2C_CON_STA;
+                }
+                else if (more) {
+                    /* Next xfer follows after a repeated start */
+                    cclr &= ~I2C_CON_STA;
+                    xfer->status = I2C_STATUS_DONE;
+                }
+                else {
+                    cclr &= ~I2C_CON_STO;
+                }
             }
             else {
                 pI2C->DAT = *xfer->txBuff++;
@@ -345,7 +357,14 @@ int handleMasterXferState(LPC_I2C_T *pI2C, I2C_XFER_T *xfer)
 
             /* Rx handling */
         case 0x58: /* Data Received and NACK sent */
-            cclr &= ~I2C_CON_STO;
+            if (more) {
+                /* Next xfer follows after a repeated start */
+                cclr &= ~I2C_CON_STA;
+                xfer->status = I2C_STATUS_DONE;
+            }
+            else {
+                cclr &= ~I2C_CON_STO;
+            }
             /* no break */
 
         case 0x50: /* Data Received and ACK sent */
@@ -386,8 +405,8 @@ int handleMasterXferState(LPC_I2C_T *pI2C, I2C_XFER_T *xfer)
     pI2C->CONSET = cclr ^ I2C_CON_FLAGS;
     pI2C->CONCLR = cclr;
 
-    /* If stopped return 0 */
-    if (!(cclr & I2C_CON_STO) || (xfer->status == I2C_STATUS_ARBLOST)) {
+    /* If stopped, or ended before a repeated start, return 0 */
+    if (!(cclr & I2C_CON_STO) || (xfer->status != I2C_STATUS_BUSY)) {
         if (xfer->status == I2C_STATUS_BUSY) {
             xfer->status = I2C_STATUS_DONE;
         }
@@ -529,6 +548,7 @@ void Chip_I2C_Init(I2C_ID_T id)
     i2c[id].flags = 0;
     i2c[id].mEvent = Chip_I2C_EventHandler;
     i2c[id].mXfer = NULL;
+    i2c[id].mMore = 0;
     i2c[id].sXfer = NULL;
 }
 
@@ -602,6 +622,51 @@ I2C_STATUS_T Chip_I2C_MasterTransfer(I2C_ID_T id, I2C_XFER_T *xfer)
     return xfer->status;
 }
 
+/* Start a master transfer without waiting for it to end */
+void Chip_I2C_MasterStartXfer(I2C_ID_T id, I2C_XFER_T *xfer)
+{
+    Chip_I2C_MasterStartSeq(id, xfer, 1);
+}
+
+/* Start a sequence of master transfers without waiting for it to end */
+void Chip_I2C_MasterStartSeq(I2C_ID_T id, I2C_XFER_T *xfers, int count)
+{
+    struct i2c_interface *iic = &i2c[id];
+    int i;
+
+    for (i = 0; i < count; i++) {
+        xfers[i].status = I2C_STATUS_BUSY;
+    }
+    iic->mXfer = xfers;
+    iic->mMore = count - 1;
+
+    /* If slave xfer not in progress */
+    if (!iic->sXfer) {
+        if (isI2CBusFree(iic->ip)) {
+            startMasterXfer(iic->ip);
+        }
+        else {
+            /* The STOP condition of the previous transfer is pending: the START condition follows it */
+            iic->ip->CONSET = I2C_CON_I2EN | I2C_CON_STA;
+        }
+    }
+}
+
+/* End a series of master transfers */
+void Chip_I2C_MasterEndXfer(I2C_ID_T id)
+{
+    struct i2c_interface *iic = &i2c[id];
+
+    iic->mXfer = 0;
+
+    /* Start slave if one is active, after the stop condition appeared on the bus */
+    if (SLAVE_ACTIVE(iic)) {
+        while (!isI2CBusFree(iic->ip)) {
+        }
+        startSlaverXfer(iic->ip);
+    }
+}
+
 /* Master tx only */
 int Chip_I2C_MasterSend(I2C_ID_T id, uint8_t slaveAddr, const uint8_t *buff, int len)
 {
@@ -651,8 +716,18 @@ int Chip_I2C_IsMasterActive(I2C_ID_T id)
 /* State change handler for master transfer */
 void Chip_I2C_MasterStateHandler(I2C_ID_T id)
 {
-    if (!handleMasterXferState(i2c[id].ip, i2c[id].mXfer)) {
-        i2c[id].mEvent(id, I2C_EVENT_DONE);
+    struct i2c_interface *iic = &i2c[id];
+
+    if (!handleMasterXferState(iic->ip, iic->mXfer, iic->mMore)) {
+        if ((iic->mXfer->status == I2C_STATUS_DONE) && (iic->mMore > 0)) {
+            /* The repeated start is on its way: continue with the next xfer of the sequence */
+            iic->mXfer++;
+            iic->mMore--;
+        }
+        else {
+            iic->mMore = 0;
+            iic->mEvent(id, I2C_EVENT_DONE);
+        }
     }
 }
 
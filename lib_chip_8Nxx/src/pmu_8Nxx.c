@@ -27,6 +27,18 @@
 #define PMU_PCON_LPMFLAG_POS            13
 #define PMU_PCON_LPMFLAG_MASK           (1u << PMU_PCON_LPMFLAG_POS)
 #define PMU_PCON_POWER_REGS_POS         0
+#define PMU_PCON_VBAT_POS               14
+#define PMU_PCON_VBAT_MASK              (1u << PMU_PCON_VBAT_POS)
+#define PMU_PCON_BODEN_POS              15
+#define PMU_PCON_BODEN_MASK             (1u << PMU_PCON_BODEN_POS)
+#define PMU_PCON_WAKEUP_POS             19
+#define PMU_PCON_WAKEUP_MASK            (1u << PMU_PCON_WAKEUP_POS)
+
+/**
+ * PCON bits that are never kept in the shadow copy: the flags report an event and are cleared by writing a 1, the VBAT
+ * bit triggers an action. Writing them as 0 has no effect.
+ */
+#define PMU_PCON_VOLATILE_MASK          (PMU_PCON_SLEEPFLAG_MASK | PMU_PCON_DPDFLAG_MASK | PMU_PCON_VBAT_MASK)
 
 /** Retained data section size in words */
 #define PMU_RETAINED_DATA_SIZE          5
@@ -40,20 +52,89 @@ static volatile int Chip_PMU_AccessCounter;
 /** Macro to write a PMU register: must be done synchronized since PMU is part of the slow RTC HW block. */
 #define PMU_WRITE(pReg, value) Chip_BusSync_WriteReg(&LPC_PMU->ACCSTAT, &Chip_PMU_AccessCounter, (pReg), (value))
 
+/** Shadow copy of PCON, without the #PMU_PCON_VOLATILE_MASK bits. Only valid when #Chip_PMU_PconValid is set. */
+static uint32_t Chip_PMU_Pcon;
+static bool Chip_PMU_PconValid;
+
+/** Volatile PCON bits to set in the next write only. */
+static uint32_t Chip_PMU_PconTrigger;
+
+/** Set when the shadow copy of PCON holds changes not yet written. */
+static bool Chip_PMU_PconDirty;
+
+/** The number of calls to #Chip_PMU_Batch_Begin not yet matched by #Chip_PMU_Batch_Commit. */
+static int Chip_PMU_BatchDepth;
+
 /*****************************************************************************
  * Private functions
  ****************************************************************************/
 
+/**
+ * Returns the shadow copy of PCON, reading the register only the first time.
+ * @pre Interrupts are disabled.
+ */
+static uint32_t GetPcon(void)
+{
+    if (!Chip_PMU_PconValid) {
+        Chip_PMU_Pcon = PMU_READ(&LPC_PMU->PCON) & ~PMU_PCON_VOLATILE_MASK;
+        Chip_PMU_PconValid = true;
+    }
+    return Chip_PMU_Pcon;
+}
+
+/**
+ * Writes the shadow copy of PCON, if it changed.
+ * @pre Interrupts are disabled.
+ */
+static void WritePcon(void)
+{
+    if (Chip_PMU_PconDirty) {
+        PMU_WRITE(&LPC_PMU->PCON, Chip_PMU_Pcon | Chip_PMU_PconTrigger);
+        Chip_PMU_PconTrigger = 0;
+        Chip_PMU_PconDirty = false;
+    }
+}
+
+/**
+ * Changes bits in the shadow copy of PCON, and writes it unless a batch is open. Nothing is written when nothing
+ * changes. Interrupts are disabled meanwhile, so that the shadow copy and the register cannot get out of step.
+ */
+static void ModifyPcon(uint32_t mask, uint32_t value)
+{
+    uint32_t pcon;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    pcon = (GetPcon() & ~(mask & ~PMU_PCON_VOLATILE_MASK)) | (value & mask & ~PMU_PCON_VOLATILE_MASK);
+    if ((pcon != Chip_PMU_Pcon) || (value & mask & PMU_PCON_VOLATILE_MASK)) {
+        Chip_PMU_Pcon = pcon;
+        Chip_PMU_PconTrigger |= value & mask & PMU_PCON_VOLATILE_MASK;
+        Chip_PMU_PconDirty = true;
+    }
+    if (Chip_PMU_BatchDepth == 0) {
+        WritePcon();
+    }
+
+    __set_PRIMASK(primask);
+}
+
 static void EnterStandbyMode(uint32_t pconFlags, uint32_t scbFlags)
 {
-    uint32_t pcon = PMU_READ(&LPC_PMU->PCON);
+    uint32_t pcon;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
 
     /* Modify PCON register - SLEEPFLAG and DPDFLAG cleared and PCON standby flags set as required
      * SLEEPFLAG and DPDFLAG are cleared before entering a standby mode so that when reading it after wakeup, it is always
-     * correct */
-    pcon = (pcon & (~0x1FFu)) | PMU_PCON_SLEEPFLAG_MASK | PMU_PCON_DPDFLAG_MASK | pconFlags;
+     * correct.
+     * The shadow copy saves reading the register: only one synchronized access remains on the way to standby. */
+    pcon = (GetPcon() & (~0x1FFu)) | pconFlags;
+    Chip_PMU_Pcon = pcon & ~PMU_PCON_VOLATILE_MASK;
+    PMU_WRITE(&LPC_PMU->PCON, pcon | PMU_PCON_SLEEPFLAG_MASK | PMU_PCON_DPDFLAG_MASK | Chip_PMU_PconTrigger);
+    Chip_PMU_PconTrigger = 0;
+    Chip_PMU_PconDirty = false;
 
-    PMU_WRITE(&LPC_PMU->PCON, pcon);
+    __set_PRIMASK(primask);
 
     /* Set SCB register in ARM core as required*/
     SCB->SCR = (SCB->SCR & (~SCB_SCR_SLEEPDEEP_Msk)) | scbFlags;
@@ -92,7 +173,7 @@ void Chip_PMU_PowerMode_EnterDeepPowerDown(bool enableSwitching)
 {
 #if defined(DEBUG)
     if(Chip_PMU_GetStatus() & PMU_STATUS_VDD_NFC) {
-        Chip_Clock_System_BusyWait_ms(500);
+        Chip_Clock_System_Wait_us(500 * 1000);
     }
 #endif
     /* DPD flag indicates that Deep Power Down mode is to be entered
@@ -129,28 +210,57 @@ bool Chip_PMU_Switch_GetVNFC(void)
 void Chip_PMU_Switch_OpenVDDBat(void)
 {
     /* Modify PCON register - VBAT set to "force off" and back to "auto" */
-    ModifyRegister(&LPC_PMU->PCON, 1 << 14, 1 << 14);
+    ModifyPcon(PMU_PCON_VBAT_MASK, PMU_PCON_VBAT_MASK);
 }
 
 void Chip_PMU_SetBODEnabled(bool enabled)
 {
     /* Modify PCON register - BODEN set to "enabled" */
-    ModifyRegister(&LPC_PMU->PCON, 1 << 15, (uint32_t)(enabled != 0) << 15);
+    ModifyPcon(PMU_PCON_BODEN_MASK, (uint32_t)(enabled != 0) << PMU_PCON_BODEN_POS);
 }
 
 bool Chip_PMU_GetBODEnabled(void)
 {
-    return (PMU_READ(&LPC_PMU->PCON) & (1 << 15)) != 0;
+    uint32_t pcon;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    pcon = GetPcon();
+    __set_PRIMASK(primask);
+    return (pcon & PMU_PCON_BODEN_MASK) != 0;
 }
 
 void Chip_PMU_SetWakeupPinEnabled(bool enabled)
 {
-    ModifyRegister(&LPC_PMU->PCON, 1 << 19, (uint32_t)(enabled != 0) << 19);
+    ModifyPcon(PMU_PCON_WAKEUP_MASK, (uint32_t)(enabled != 0) << PMU_PCON_WAKEUP_POS);
 }
 
 bool Chip_PMU_GetWakeupPinEnabled(void)
 {
-    return (PMU_READ(&LPC_PMU->PCON) & (1 << 19)) != 0;
+    uint32_t pcon;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    pcon = GetPcon();
+    __set_PRIMASK(primask);
+    return (pcon & PMU_PCON_WAKEUP_MASK) != 0;
+}
+
+void Chip_PMU_Batch_Begin(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    Chip_PMU_BatchDepth++;
+    __set_PRIMASK(primask);
+}
+
+void Chip_PMU_Batch_Commit(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    ASSERT(Chip_PMU_BatchDepth > 0);
+    if (--Chip_PMU_BatchDepth == 0) {
+        WritePcon();
+    }
+    __set_PRIMASK(primask);
 }
 
 void Chip_PMU_SetRTCClockSource(PMU_RTC_CLOCKSOURCE_T source)
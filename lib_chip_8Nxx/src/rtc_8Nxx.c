@@ -26,6 +26,57 @@ static volatile int Chip_RTC_AccessCounter;
 /** Macro to write an RTC register */
 #define RTC_WRITE(pReg, value) Chip_BusSync_WriteReg(&LPC_RTC->ACCSTAT, &Chip_RTC_AccessCounter, (pReg), (value))
 
+/** The RTC registers of which a shadow copy is kept: these only change when written by software. */
+typedef enum RTC_SHADOW {
+    RTC_SHADOW_CR,
+    RTC_SHADOW_SLEEPT,
+    RTC_SHADOW_IMSC,
+    RTC_SHADOW_CAL,
+    RTC_SHADOW_COUNT
+} RTC_SHADOW_T;
+
+/** Shadow copies of RTC registers, indexed by #RTC_SHADOW_T. Entry @c n is valid when bit @c n of Chip_RTC_Valid is
+ * set. */
+static uint32_t Chip_RTC_Shadow[RTC_SHADOW_COUNT];
+static uint32_t Chip_RTC_Valid;
+
+/*****************************************************************************
+ * Private functions
+ ****************************************************************************/
+
+/** Reads a register through its shadow copy: only the first read accesses the register. */
+static uint32_t ReadShadow(RTC_SHADOW_T n, __I uint32_t *pReg)
+{
+    uint32_t value;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (!(Chip_RTC_Valid & (1u << n))) {
+        Chip_RTC_Shadow[n] = RTC_READ(pReg);
+        Chip_RTC_Valid |= 1u << n;
+    }
+    value = Chip_RTC_Shadow[n];
+    __set_PRIMASK(primask);
+    return value;
+}
+
+/**
+ * Writes a register and its shadow copy. Interrupts are disabled meanwhile, so that the shadow copy and the register
+ * cannot get out of step.
+ * @param always : @c false to skip the write when the register already holds @c value: only for registers for which
+ *  writing has no side effect.
+ */
+static void WriteShadow(RTC_SHADOW_T n, __IO uint32_t *pReg, uint32_t value, bool always)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (always || !(Chip_RTC_Valid & (1u << n)) || (Chip_RTC_Shadow[n] != value)) {
+        RTC_WRITE(pReg, value);
+        Chip_RTC_Shadow[n] = value;
+        Chip_RTC_Valid |= 1u << n;
+    }
+    __set_PRIMASK(primask);
+}
+
 /*****************************************************************************
  * Public functions
  ****************************************************************************/
@@ -44,10 +95,10 @@ void Chip_RTC_Init(LPC_RTC_T * pRTC)
 void Chip_RTC_DeInit(LPC_RTC_T *pRTC)
 {
     // 1. Stop RTC "wake-up down-counter"
-    RTC_WRITE(&pRTC->CR, RTC_WAKEUPCTRL_DISABLE);
+    WriteShadow(RTC_SHADOW_CR, &pRTC->CR, RTC_WAKEUPCTRL_DISABLE, false);
 
     // 2. Disable 'wake-up' interrupt 
-    RTC_WRITE(&pRTC->IMSC, RTC_INT_NONE);
+    WriteShadow(RTC_SHADOW_IMSC, &pRTC->IMSC, RTC_INT_NONE, false);
 
     // 3. Disable RTC block register access from APB
     Chip_Clock_Peripheral_DisableClock(CLOCK_PERIPHERAL_RTC);
@@ -57,38 +108,46 @@ void Chip_RTC_DeInit(LPC_RTC_T *pRTC)
 // Sets the number of TFRO clock pulses in one RTC 'tick'
 void Chip_RTC_SetCalibration(LPC_RTC_T *pRTC, int calibValue)
 {
-    RTC_WRITE(&pRTC->CAL, calibValue & 0x0000FFFF);
+    WriteShadow(RTC_SHADOW_CAL, &pRTC->CAL, (uint32_t)calibValue & 0x0000FFFF, false);
 }
 
 
  // Returns the number of TFRO clock pulses in one RTC 'tick'
 int Chip_RTC_GetCalibration(LPC_RTC_T *pRTC)
 {   // return 16bit masked result
-    return 0x0000FFFF & RTC_READ(&pRTC->CAL);
+    return (int)(0x0000FFFF & ReadShadow(RTC_SHADOW_CAL, &pRTC->CAL));
 }
 
 // Controls the operation of "wake-up down-counter"
 void Chip_RTC_Wakeup_SetControl(LPC_RTC_T *pRTC, RTC_WAKEUPCTRL_T control)
 {
-    RTC_WRITE(&pRTC->CR, (int) control & 0x07);
+    /* Writing START (re)starts counting: only skip writes that cannot have an effect. */
+    WriteShadow(RTC_SHADOW_CR, &pRTC->CR, (uint32_t)control & 0x07, (control & RTC_WAKEUPCTRL_START) != 0);
 }
 
 // Returns the control register of the "wake-up down-counter" operation
 RTC_WAKEUPCTRL_T Chip_RTC_Wakeup_GetControl(LPC_RTC_T *pRTC)
 {
-    return (RTC_WAKEUPCTRL_T) (RTC_READ(&pRTC->CR) & 0x7);
+    uint32_t control = ReadShadow(RTC_SHADOW_CR, &pRTC->CR);
+
+    /* The hardware clears START itself: then the copy cannot be trusted. */
+    if (control & RTC_WAKEUPCTRL_START) {
+        control = RTC_READ(&pRTC->CR);
+    }
+    return (RTC_WAKEUPCTRL_T) (control & 0x7);
 }
 
 // Sets the "wake-up down-counter" ticks.  
 void Chip_RTC_Wakeup_SetReload(LPC_RTC_T *pRTC, int ticks)
 {
-    RTC_WRITE(&pRTC->SLEEPT, 0xFFFFFF & ticks);
+    /* Writing restarts counting with AUTO set: never skipped. */
+    WriteShadow(RTC_SHADOW_SLEEPT, &pRTC->SLEEPT, 0xFFFFFF & (uint32_t)ticks, true);
 }
 
 // Returns the number of "wake-up down-counter" ticks (seconds) previously set by #Chip_RTC_Wakeup_SetReload
 int Chip_RTC_Wakeup_GetReload(LPC_RTC_T *pRTC)
 {
-    return 0x00FFFFFF & RTC_READ(&pRTC->SLEEPT);
+    return (int)(0x00FFFFFF & ReadShadow(RTC_SHADOW_SLEEPT, &pRTC->SLEEPT));
 }
 
 // Returns the remaining ("wake-up down-counter") ticks until 'wake-up' event occurs
@@ -121,13 +180,13 @@ void Chip_RTC_Time_SetValue(LPC_RTC_T *pRTC, int tickValue)
 // Enables/Disables RTC interrupt event
 void Chip_RTC_Int_SetEnabledMask(LPC_RTC_T *pRTC, RTC_INT_T mask)
 {
-    RTC_WRITE(&pRTC->IMSC, RTC_INT_ALL & mask);
+    WriteShadow(RTC_SHADOW_IMSC, &pRTC->IMSC, RTC_INT_ALL & mask, false);
 }
 
 // Retrieves the RTC interrupt enable bitfield
 RTC_INT_T Chip_RTC_Int_GetEnabledMask(LPC_RTC_T *pRTC)
 {
-    return (RTC_INT_T) (RTC_INT_ALL & RTC_READ(&pRTC->IMSC));
+    return (RTC_INT_T) (RTC_INT_ALL & ReadShadow(RTC_SHADOW_IMSC, &pRTC->IMSC));
 }
 
 // Retrieves the reason(s) of RTC interrupt event
@@ -83,6 +83,115 @@ static void SSP_Read1BFifo(LPC_SSP_T *pSSP, Chip_SSP_DATA_SETUP_T *xf_setup)
     }
 }
 
+/* Writes n frames, at most SSP_FIFO_DEPTH, without checking for room in the TX FIFO. A step of 0 repeats *pTx. */
+static void SSP_WriteBatch8(LPC_SSP_T *pSSP, const uint8_t *pTx, int step, uint32_t n)
+{
+    switch (n) {
+        default:
+            pSSP->DR = *pTx; pTx += step; /* fall through */
+        case 7:
+            pSSP->DR = *pTx; pTx += step; /* fall through */
+        case 6:
+            pSSP->DR = *pTx; pTx += step; /* fall through */
+        case 5:
+            pSSP->DR = *pTx; pTx += step; /* fall through */
+        case 4:
+            pSSP->DR = *pTx; pTx += step; /* fall through */
+        case 3:
+            pSSP->DR = *pTx; pTx += step; /* fall through */
+        case 2:
+            pSSP->DR = *pTx; pTx += step; /* fall through */
+        case 1:
+            pSSP->DR = *pTx; /* fall through */
+        case 0:
+            break;
+    }
+}
+
+/* Reads n frames, at most SSP_FIFO_DEPTH, without checking the RX FIFO. A step of 0 overwrites *pRx. */
+static void SSP_ReadBatch8(LPC_SSP_T *pSSP, uint8_t *pRx, int step, uint32_t n)
+{
+    switch (n) {
+        default:
+            *pRx = (uint8_t)pSSP->DR; pRx += step; /* fall through */
+        case 7:
+            *pRx = (uint8_t)pSSP->DR; pRx += step; /* fall through */
+        case 6:
+            *pRx = (uint8_t)pSSP->DR; pRx += step; /* fall through */
+        case 5:
+            *pRx = (uint8_t)pSSP->DR; pRx += step; /* fall through */
+        case 4:
+            *pRx = (uint8_t)pSSP->DR; pRx += step; /* fall through */
+        case 3:
+            *pRx = (uint8_t)pSSP->DR; pRx += step; /* fall through */
+        case 2:
+            *pRx = (uint8_t)pSSP->DR; pRx += step; /* fall through */
+        case 1:
+            *pRx = (uint8_t)pSSP->DR; /* fall through */
+        case 0:
+            break;
+    }
+}
+
+/* 16-bit variant of SSP_WriteBatch8 */
+static void SSP_WriteBatch16(LPC_SSP_T *pSSP, const uint16_t *pTx, int step, uint32_t n)
+{
+    switch (n) {
+        default:
+            pSSP->DR = *pTx; pTx += step; /* fall through */
+        case 7:
+            pSSP->DR = *pTx; pTx += step; /* fall through */
+        case 6:
+            pSSP->DR = *pTx; pTx += step; /* fall through */
+        case 5:
+            pSSP->DR = *pTx; pTx += step; /* fall through */
+        case 4:
+            pSSP->DR = *pTx; pTx += step; /* fall through */
+        case 3:
+            pSSP->DR = *pTx; pTx += step; /* fall through */
+        case 2:
+            pSSP->DR = *pTx; pTx += step; /* fall through */
+        case 1:
+            pSSP->DR = *pTx; /* fall through */
+        case 0:
+            break;
+    }
+}
+
+/* 16-bit variant of SSP_ReadBatch8 */
+static void SSP_ReadBatch16(LPC_SSP_T *pSSP, uint16_t *pRx, int step, uint32_t n)
+{
+    switch (n) {
+        default:
+            *pRx = (uint16_t)pSSP->DR; pRx += step; /* fall through */
+        case 7:
+            *pRx = (uint16_t)pSSP->DR; pRx += step; /* fall through */
+        case 6:
+            *pRx = (uint16_t)pSSP->DR; pRx += step; /* fall through */
+        case 5:
+            *pRx = (uint16_t)pSSP->DR; pRx += step; /* fall through */
+        case 4:
+            *pRx = (uint16_t)pSSP->DR; pRx += step; /* fall through */
+        case 3:
+            *pRx = (uint16_t)pSSP->DR; pRx += step; /* fall through */
+        case 2:
+            *pRx = (uint16_t)pSSP->DR; pRx += step; /* fall through */
+        case 1:
+            *pRx = (uint16_t)pSSP->DR; /* fall through */
+        case 0:
+            break;
+    }
+}
+
+/* Empties the RX FIFO and clears the overrun and timeout flags */
+static void SSP_Flush(LPC_SSP_T *pSSP)
+{
+    while (Chip_SSP_GetStatus(pSSP, SSP_STAT_RNE)) {
+        Chip_SSP_ReceiveFrame(pSSP);
+    }
+    Chip_SSP_ClearIntPending(pSSP, SSP_INT_CLEAR_BITMASK);
+}
+
 /* Returns clock for the peripheral block */
 static CLOCK_PERIPHERAL_T Chip_SSP_GetClockIndex(LPC_SSP_T *pSSP)
 {
@@ -193,6 +302,53 @@ uint32_t Chip_SSP_RWFrames_Blocking(LPC_SSP_T *pSSP, Chip_SSP_DATA_SETUP_T *xf_s
     return 0;
 }
 
+/* SSP Polling Read/Write of 8-bit frames in blocking mode, one FIFO batch at a time */
+uint32_t Chip_SSP_RWFrames8_Blocking(LPC_SSP_T *pSSP, const uint8_t *pTx, uint8_t *pRx, uint32_t count)
+{
+    static const uint8_t fill = 0xFF;
+    uint8_t sink;
+    uint32_t done = 0;
+    uint32_t n;
+
+    SSP_Flush(pSSP);
+    while (done < count) {
+        n = ((count - done) < SSP_FIFO_DEPTH) ? (count - done) : SSP_FIFO_DEPTH;
+        SSP_WriteBatch8(pSSP, pTx ? &pTx[done] : &fill, pTx ? 1 : 0, n);
+        /* With the TX FIFO empty and the last frame shifted out, all n frames are in the RX FIFO. */
+        while (pSSP->SR & SSP_STAT_BSY) {
+        }
+        if (Chip_SSP_GetRawIntStatus(pSSP, SSP_RORRIS) == SET) {
+            return ERROR;
+        }
+        SSP_ReadBatch8(pSSP, pRx ? &pRx[done] : &sink, pRx ? 1 : 0, n);
+        done += n;
+    }
+    return done;
+}
+
+/* SSP Polling Read/Write of 16-bit frames in blocking mode, one FIFO batch at a time */
+uint32_t Chip_SSP_RWFrames16_Blocking(LPC_SSP_T *pSSP, const uint16_t *pTx, uint16_t *pRx, uint32_t count)
+{
+    static const uint16_t fill = 0xFFFF;
+    uint16_t sink;
+    uint32_t done = 0;
+    uint32_t n;
+
+    SSP_Flush(pSSP);
+    while (done < count) {
+        n = ((count - done) < SSP_FIFO_DEPTH) ? (count - done) : SSP_FIFO_DEPTH;
+        SSP_WriteBatch16(pSSP, pTx ? &pTx[done] : &fill, pTx ? 1 : 0, n);
+        while (pSSP->SR & SSP_STAT_BSY) {
+        }
+        if (Chip_SSP_GetRawIntStatus(pSSP, SSP_RORRIS) == SET) {
+            return ERROR;
+        }
+        SSP_ReadBatch16(pSSP, pRx ? &pRx[done] : &sink, pRx ? 1 : 0, n);
+        done += n;
+    }
+    return done;
+}
+
 /* SSP Polling Write in blocking mode */
 uint32_t Chip_SSP_WriteFrames_Blocking(LPC_SSP_T *pSSP, uint8_t *buffer, uint32_t buffer_len)
 {
@@ -448,8 +604,8 @@ uint32_t Chip_SSP_GetBitRate(LPC_SSP_T *pSSP)
 {
     uint32_t serialClockRate = (pSSP->CR0 >> 8) & 0xFF;
     uint32_t prescaler = pSSP->CPSR;
-    uint32_t sysClk = (uint32_t)Chip_Clock_System_GetClockFreq();
-    uint32_t bitrate = (uint32_t)(sysClk / (prescaler * (serialClockRate + 1.0)));
+    uint32_t sspClk = Chip_SSP_GetPCLKkRate(pSSP); /* The SFRO divided by the SPI0 clock divider */
+    uint32_t bitrate = (uint32_t)(sspClk / (prescaler * (serialClockRate + 1.0)));
     return bitrate;
 }
 
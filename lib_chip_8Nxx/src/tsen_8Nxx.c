@@ -19,6 +19,45 @@
  */
 #define IDIV(n,d) ( ( (n)>0 ? (n)+(d)/2 : (n)-(d)/2 ) / (d) )
 
+/**
+ * Division free counterpart of #IDIV for a divisor known up front.
+ * The Cortex-M0+ has no hardware divider: each '/' costs a call into the run-time library divide routine.
+ * Instead, the division is replaced by a multiplication with the rounded-up reciprocal of the divisor:
+ *  floor(n / d) == (n * magic) >> shift  for all 0 <= n < 2^31, with shift = 31 + ceil(log2(d)) and
+ *  magic = ceil(2^shift / d), which always fits in 32 bits.
+ * The rounding to closest number - with the same tie breaking as #IDIV - is applied on the magnitude.
+ */
+#define RDIV(n,d,magic,shift) ( (n)>0 ? (int)MulShift((uint32_t)(n)+(d)/2, (magic), (shift)) \
+                                      : -(int)MulShift((uint32_t)(-(n))+(d)/2, (magic), (shift)) )
+
+/** Reciprocal of 640, used by #Chip_TSen_NativeToCelsius */
+#define MAGIC_640 0xCCCCCCCDu
+#define SHIFT_640 41
+
+/** Reciprocal of 100 * 2^n is MAGIC_100 with a shift of SHIFT_100 + n, used by #Chip_TSen_NativeToFahrenheit */
+#define MAGIC_100 0xA3D70A3Eu
+#define SHIFT_100 38
+
+/** Reciprocals of the Fahrenheit divisor 100 * (1024 / multiplier) for the decimal multipliers */
+static const struct {
+    uint16_t multiplier;
+    uint16_t m; /* 1024 / multiplier */
+    uint32_t magic;
+    uint32_t shift;
+} sFahrenheitDivisors[] = {
+    {10, 102, 0xCD9A6735u, 45},
+    {100, 10, 0x83126E98u, 41},
+    {1000, 1, MAGIC_100, SHIFT_100}
+};
+
+/* ------------------------------------------------------------------------- */
+
+/* Returns (n * magic) >> shift using a 32x32->64 bit multiplication */
+static inline uint32_t MulShift(uint32_t n, uint32_t magic, uint32_t shift)
+{
+    return (uint32_t)(((uint64_t)n * magic) >> shift);
+}
+
 /* ------------------------------------------------------------------------- */
 
 /* Initialize and configure the TSEN peripheral */
@@ -107,7 +146,8 @@ int Chip_TSen_NativeToKelvin(int native, int multiplier)
     ASSERT(multiplier > 0);
 
     /* As native format is 1-(9,6), to obtain the temperature in Kelvin, it must be divided by 2^6 */
-    return IDIV(native * multiplier, 64);
+    int n = native * multiplier;
+    return n > 0 ? (n + 32) >> 6 : -((32 - n) >> 6);
 }
 
 /* Convert a temperature value in a human readable format in Kelvin to the HW format */
@@ -126,7 +166,7 @@ int Chip_TSen_NativeToCelsius(int native, int multiplier)
 
     /* The formula for converting Native directly to Celsius is: C = (N - 273.15*64) / 64
      * Note that native format is 1-(9,6) */
-    return IDIV(((native * 10) - 174816) * multiplier, 640);
+    return RDIV(((native * 10) - 174816) * multiplier, 640, MAGIC_640, SHIFT_640);
 }
 
 /* Convert a temperature value in a human readable format in Celsius to the HW format */
@@ -146,7 +186,31 @@ int Chip_TSen_NativeToFahrenheit(int native, int multiplier)
 
     /* The formula for converting Native directly to Fahrenheit is: F = (N * 9/320) - 459,67
      * Note that native format is 1-(9,6) */
-    int m = 1024 / multiplier;
+    int m;
+    int n;
+    uint32_t i;
+
+    if ((multiplier & (multiplier - 1)) == 0) {
+        /* m = 1024 / multiplier is a power of two as well: the divisor 100 * m is a shifted version of 100 */
+        uint32_t shift = SHIFT_100;
+        for (m = 1; m * multiplier < 1024; m <<= 1) {
+            shift++;
+        }
+        n = native * 45 * 1024;
+        n = (n > 0 ? (n + 8) >> 4 : -((8 - n) >> 4)) - (45967 * 1024);
+        return RDIV(n, 100 * m, MAGIC_100, shift);
+    }
+    for (i = 0; i < sizeof(sFahrenheitDivisors) / sizeof(sFahrenheitDivisors[0]); i++) {
+        if (sFahrenheitDivisors[i].multiplier == multiplier) {
+            m = sFahrenheitDivisors[i].m;
+            n = native * 45 * multiplier * m;
+            n = (n > 0 ? (n + 8) >> 4 : -((8 - n) >> 4)) - (45967 * multiplier * m);
+            return RDIV(n, 100 * m, sFahrenheitDivisors[i].magic, sFahrenheitDivisors[i].shift);
+        }
+    }
+
+    /* Any other multiplier: fall back on the generic - and slow - integer divisions */
+    m = 1024 / multiplier;
     return IDIV( IDIV(native*45*multiplier*m, 16) - (45967*multiplier*m), 100 * m);
 }
 
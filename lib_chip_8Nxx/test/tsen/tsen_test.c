@@ -0,0 +1,121 @@
+/*
+ * Copyright (c), NXP Semiconductors
+ * (C)NXP B.V. 2014-2017
+ * All rights are reserved. Reproduction in whole or in part is prohibited without
+ * the written consent of the copyright owner. NXP reserves the right to make
+ * changes without notice at any time. NXP makes no warranty, expressed, implied or
+ * statutory, including but not limited to any implied warranty of merchantability
+ * or fitness for any particular purpose, or that the use will not infringe any
+ * third party patent, copyright or trademark. NXP must not be liable for any loss
+ * or damage arising from its use.
+ */
+
+/*
+ * Host test of the tsen driver conversions. Chip_TSen_NativeToKelvin, Chip_TSen_NativeToCelsius and
+ * Chip_TSen_NativeToFahrenheit avoid the run-time library divide routine of the Cortex-M0+. They are checked here to
+ * return exactly what the original integer division formulas return, for every 16-bit native value and for every
+ * multiplier from 1 up to 1024.
+ * The time per call of both versions is printed as well. Note that the host has a hardware divider: these numbers
+ * only hint at the gain on the target, where each division costs a call into the library.
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "chip.h"
+
+/* ------------------------------------------------------------------------- */
+
+#define MULTIPLIER_MAX 1024
+#define BENCHMARK_ROUNDS 20
+
+#define IDIV(n,d) ( ( (n)>0 ? (n)+(d)/2 : (n)-(d)/2 ) / (d) )
+
+typedef int (*CONVERT_T)(int native, int multiplier);
+
+static int sFailures;
+
+/* ------------------------------------------------------------------------- */
+
+/** The original implementation of #Chip_TSen_NativeToKelvin */
+static int KelvinByDivision(int native, int multiplier)
+{
+    return IDIV(native * multiplier, 64);
+}
+
+/** The original implementation of #Chip_TSen_NativeToCelsius */
+static int CelsiusByDivision(int native, int multiplier)
+{
+    return IDIV(((native * 10) - 174816) * multiplier, 640);
+}
+
+/** The original implementation of #Chip_TSen_NativeToFahrenheit */
+static int FahrenheitByDivision(int native, int multiplier)
+{
+    int m = 1024 / multiplier;
+    return IDIV( IDIV(native*45*multiplier*m, 16) - (45967*multiplier*m), 100 * m);
+}
+
+/** Compares @a convert against @a reference for all native values and multipliers. */
+static void Compare(const char *name, CONVERT_T convert, CONVERT_T reference)
+{
+    int multiplier;
+    int native;
+    int mismatches = 0;
+
+    for (multiplier = 1; multiplier <= MULTIPLIER_MAX; multiplier++) {
+        for (native = INT16_MIN; native <= INT16_MAX; native++) {
+            int expected = reference(native, multiplier);
+            int actual = convert(native, multiplier);
+            if (actual != expected) {
+                if (mismatches < 10) {
+                    printf("FAIL %s(%d, %d): %d instead of %d\n", name, native, multiplier, actual, expected);
+                }
+                mismatches++;
+            }
+        }
+    }
+    sFailures += mismatches;
+}
+
+/** Returns the time per call, in ns, of @a convert for the multiplier @a multiplier and all native values. */
+static double Time(CONVERT_T convert, int multiplier)
+{
+    volatile int sink = 0;
+    clock_t start = clock();
+    int round;
+    int native;
+
+    for (round = 0; round < BENCHMARK_ROUNDS; round++) {
+        for (native = INT16_MIN; native <= INT16_MAX; native++) {
+            sink += convert(native, multiplier);
+        }
+    }
+    (void)sink;
+    return (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / (BENCHMARK_ROUNDS * 65536.0);
+}
+
+static void Benchmark(const char *name, CONVERT_T convert, CONVERT_T reference, int multiplier)
+{
+    printf("%-10s x%-4d %6.2f ns by division, %6.2f ns division free\n", name, multiplier, Time(reference, multiplier),
+           Time(convert, multiplier));
+}
+
+/* ------------------------------------------------------------------------- */
+
+int main(void)
+{
+    Compare("Kelvin", Chip_TSen_NativeToKelvin, KelvinByDivision);
+    Compare("Celsius", Chip_TSen_NativeToCelsius, CelsiusByDivision);
+    Compare("Fahrenheit", Chip_TSen_NativeToFahrenheit, FahrenheitByDivision);
+    if (sFailures) {
+        printf("%d failures\n", sFailures);
+        return 1;
+    }
+
+    Benchmark("Kelvin", Chip_TSen_NativeToKelvin, KelvinByDivision, 10);
+    Benchmark("Celsius", Chip_TSen_NativeToCelsius, CelsiusByDivision, 10);
+    Benchmark("Fahrenheit", Chip_TSen_NativeToFahrenheit, FahrenheitByDivision, 10);
+    Benchmark("Fahrenheit", Chip_TSen_NativeToFahrenheit, FahrenheitByDivision, 64);
+    printf("tsen: all tests passed\n");
+    return 0;
+}